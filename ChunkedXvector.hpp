@@ -0,0 +1,623 @@
+/**
+ * @file ChunkedXvector.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief A vector that grows by adding fixed-size chunks instead of copying
+ *        its elements into a larger array. Growth costs one chunk allocation
+ *        and a pointer append, so push_back has no latency spikes and no
+ *        transient memory peak, and elements never move.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>   // for size_t, ptrdiff_t
+#include <iterator>  // for random_access_iterator_tag
+#include <memory>    // for allocator, allocator_traits
+#include <stdexcept> // for basic exceptions
+#include <utility>   // for forward, move, swap
+#include "Xvector.hpp"
+using namespace std;
+
+/**
+ * @brief A container of chunks of ChunkSize elements each, found through a
+ *        table of chunk pointers. Element i lives at offset i % ChunkSize of
+ *        chunk i / ChunkSize, so indexing is a shift, a mask and two loads.
+ *        References to elements stay valid until the element is removed;
+ *        iterators are invalidated when a chunk is added or removed.
+ *
+ *        For tight loops, for_each_chunk hands each chunk over as a plain
+ *        pointer range that the compiler can vectorize.
+ *
+ * @tparam T type of element.
+ * @tparam ChunkSize number of elements per chunk, a power of two, default is
+ *         1024.
+ * @tparam Alloc type of allocator, default is std::allocator<T>
+ */
+template <typename T, size_t ChunkSize = 1024, typename Alloc = std::allocator<T>>
+class ChunkedXvector
+{
+    static_assert(ChunkSize && !(ChunkSize & (ChunkSize - 1)), "ChunkSize must be a power of two");
+
+private:
+    static constexpr size_t chunk_bits = xvector_log2(ChunkSize);
+
+    using alloc_traits = allocator_traits<Alloc>;
+    using table_alloc = typename alloc_traits::template rebind_alloc<T *>;
+
+    Alloc alloc;                                               // Allocator for chunks
+    Xvector<T *, table_alloc, xvector_growth_double, 8> table; // Chunk pointers, then a null sentinel
+    size_t chunked_size{0};                                    // Number of elements
+
+    /**
+     * @brief Returns the number of allocated chunks.
+     *
+     * @return size_t
+     */
+    size_t chunk_total() const;
+
+    /**
+     * @brief Allocates one more chunk and appends it to the table.
+     *
+     */
+    void add_chunk();
+
+    /**
+     * @brief Destroys every element and frees chunks beyond the given count.
+     *
+     * @param keep Number of chunks to keep.
+     */
+    void destroy_all(size_t keep);
+
+public:
+    /**
+     * @brief Random access iterator that walks a chunk with a plain pointer
+     *        and only consults the chunk table when it crosses into the next
+     *        chunk.
+     *
+     * @tparam Const true for a const_iterator.
+     */
+    template <bool Const>
+    class basic_iterator
+    {
+    private:
+        T *const *node{nullptr}; // Table entry of the current chunk
+        T *cur{nullptr};         // Current element
+
+        template <bool>
+        friend class basic_iterator;
+
+    public:
+        using iterator_category = random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = conditional_t<Const, const T *, T *>;
+        using reference = conditional_t<Const, const T &, T &>;
+
+        basic_iterator() {}
+        basic_iterator(T *const *_node, T *_cur) : node(_node), cur(_cur) {}
+        operator basic_iterator<true>() const { return basic_iterator<true>(node, cur); }
+
+        reference operator*() const { return *cur; }
+        pointer operator->() const { return cur; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        basic_iterator &operator++()
+        {
+            if (++cur == *node + ChunkSize) // The sentinel makes this safe at the end
+                cur = *++node;
+            return *this;
+        }
+        basic_iterator operator++(int) { basic_iterator tmp = *this; ++*this; return tmp; }
+        basic_iterator &operator--()
+        {
+            if (cur == *node)
+                cur = *--node + ChunkSize;
+            --cur;
+            return *this;
+        }
+        basic_iterator operator--(int) { basic_iterator tmp = *this; --*this; return tmp; }
+        basic_iterator &operator+=(difference_type n)
+        {
+            difference_type offset = (cur - *node) + n;
+            difference_type chunk = offset >= 0 ? offset >> chunk_bits : -((-offset - 1) >> chunk_bits) - 1;
+            node += chunk;
+            cur = *node + (offset - chunk * difference_type(ChunkSize));
+            return *this;
+        }
+        basic_iterator &operator-=(difference_type n) { return *this += -n; }
+        basic_iterator operator+(difference_type n) const { basic_iterator tmp = *this; return tmp += n; }
+        basic_iterator operator-(difference_type n) const { basic_iterator tmp = *this; return tmp += -n; }
+        difference_type operator-(const basic_iterator &other) const
+        {
+            return (node - other.node) * difference_type(ChunkSize) + (cur - *node) - (other.cur - *other.node);
+        }
+
+        bool operator==(const basic_iterator &other) const { return cur == other.cur && node == other.node; }
+        bool operator!=(const basic_iterator &other) const { return !(*this == other); }
+        bool operator<(const basic_iterator &other) const { return *this - other < 0; }
+        bool operator>(const basic_iterator &other) const { return *this - other > 0; }
+        bool operator<=(const basic_iterator &other) const { return *this - other <= 0; }
+        bool operator>=(const basic_iterator &other) const { return *this - other >= 0; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using allocator_type = Alloc;
+
+    /**
+     * @brief Construct a new ChunkedXvector object. No chunk is allocated
+     *        until the first push_back.
+     *
+     * @param a Allocator to be copied.
+     */
+    explicit ChunkedXvector(const Alloc &a = Alloc());
+
+    /**
+     * @brief Construct a new ChunkedXvector object holding a copy of every
+     *        element of another.
+     *
+     * @param other Vector to be copied.
+     */
+    ChunkedXvector(const ChunkedXvector &other);
+
+    /**
+     * @brief Construct a new ChunkedXvector object by taking over the chunks
+     *        of another, which is left empty.
+     *
+     * @param other Vector to be moved from.
+     */
+    ChunkedXvector(ChunkedXvector &&other) noexcept;
+
+    /**
+     * @brief Replaces the contents with copies of another vector's elements.
+     *
+     * @param other Vector to be copied.
+     * @return ChunkedXvector&
+     */
+    ChunkedXvector &operator=(const ChunkedXvector &other);
+
+    /**
+     * @brief Replaces the contents with the chunks of another vector, which
+     *        is left empty.
+     *
+     * @param other Vector to be moved from.
+     * @return ChunkedXvector&
+     */
+    ChunkedXvector &operator=(ChunkedXvector &&other) noexcept;
+
+    /**
+     * @brief Destroy the ChunkedXvector object.
+     *
+     */
+    ~ChunkedXvector();
+
+    /**
+     * @brief Tests if the vector is empty.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the current number of elements in the vector.
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the number of elements the allocated chunks can hold.
+     *
+     * @return size_t
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Allocates chunks until the vector can hold the given number of
+     *        elements.
+     *
+     * @param new_capacity Minimum capacity of the vector.
+     */
+    void reserve(size_t new_capacity);
+
+    /**
+     * @brief Frees the chunks past the last element.
+     *
+     */
+    void shrink_to_fit();
+
+    /**
+     * @brief Inserts an element at the end of the vector.
+     *
+     * @param x The value to be inserted.
+     */
+    void push_back(const T &x);
+
+    /**
+     * @brief Inserts an element at the end of the vector.
+     *
+     * @param x The value to be inserted.
+     */
+    void push_back(T &&x);
+
+    /**
+     * @brief Constructs an element in place at the end of the vector.
+     *
+     * @tparam Args types of the constructor arguments.
+     * @param args Arguments forwarded to the constructor of T.
+     * @return T& reference to the new element.
+     */
+    template <typename... Args>
+    T &emplace_back(Args &&...args);
+
+    /**
+     * @brief Removes the last element. Its chunk is kept for reuse.
+     *
+     */
+    void pop_back();
+
+    /**
+     * @brief Erases all elements and frees every chunk.
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Returns a reference to the element at the given index.
+     *
+     * @param pos Index of the element.
+     * @return T&
+     */
+    T &operator[](size_t pos);
+
+    /**
+     * @brief Returns a constant reference to the element at the given index.
+     *
+     * @param pos Index of the element.
+     * @return const T&
+     */
+    const T &operator[](size_t pos) const;
+
+    /**
+     * @brief Returns a reference to the element at the given index. Throws
+     *        std::out_of_range if the index is not within the vector.
+     *
+     * @param pos Index of the element.
+     * @return T&
+     */
+    T &at(size_t pos);
+
+    /**
+     * @brief Returns a constant reference to the element at the given index.
+     *        Throws std::out_of_range if the index is not within the vector.
+     *
+     * @param pos Index of the element.
+     * @return const T&
+     */
+    const T &at(size_t pos) const;
+
+    /**
+     * @brief Returns a reference to the last element.
+     *
+     * @return T&
+     */
+    T &back();
+
+    /**
+     * @brief Calls fn(first, last) once per chunk that holds elements, in
+     *        order, with a pointer range covering that chunk's elements.
+     *
+     * @tparam Fn type of callable taking (T*, T*).
+     * @param fn Callable to be invoked.
+     */
+    template <typename Fn>
+    void for_each_chunk(Fn fn);
+
+    /**
+     * @brief Calls fn(first, last) once per chunk that holds elements, in
+     *        order, with a constant pointer range covering that chunk's
+     *        elements.
+     *
+     * @tparam Fn type of callable taking (const T*, const T*).
+     * @param fn Callable to be invoked.
+     */
+    template <typename Fn>
+    void for_each_chunk(Fn fn) const;
+
+    /**
+     * @brief Returns an iterator to the first element in the vector.
+     *
+     * @return iterator
+     */
+    iterator begin();
+
+    /**
+     * @brief Returns a constant iterator to the first element in the vector.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns an iterator to the element one past the last element in
+     *        the vector.
+     *
+     * @return iterator
+     */
+    iterator end();
+
+    /**
+     * @brief Returns a constant iterator to the element one past the last
+     *        element in the vector.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const;
+};
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline size_t ChunkedXvector<T, ChunkSize, Alloc>::chunk_total() const
+{
+    return table.size() - 1;
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+void ChunkedXvector<T, ChunkSize, Alloc>::add_chunk()
+{
+    T *chunk = alloc_traits::allocate(alloc, ChunkSize);
+    try
+    {
+        table.push_back(nullptr); // New sentinel first, so a throw leaves the table as it was
+    }
+    catch (...)
+    {
+        alloc_traits::deallocate(alloc, chunk, ChunkSize);
+        throw;
+    }
+    table[table.size() - 2] = chunk;
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+void ChunkedXvector<T, ChunkSize, Alloc>::destroy_all(size_t keep)
+{
+    if constexpr (!is_trivially_destructible<T>::value)
+        for (size_t i = 0; i < chunked_size; i++)
+            alloc_traits::destroy(alloc, &(*this)[i]);
+    chunked_size = 0;
+    while (chunk_total() > keep)
+    {
+        alloc_traits::deallocate(alloc, table[table.size() - 2], ChunkSize);
+        table.pop_back();
+        table[table.size() - 1] = nullptr;
+    }
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline ChunkedXvector<T, ChunkSize, Alloc>::ChunkedXvector(const Alloc &a) : alloc(a), table(table_alloc(a))
+{
+    table.push_back(nullptr); // Fits in the table's inline buffer, so nothing is allocated
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+ChunkedXvector<T, ChunkSize, Alloc>::ChunkedXvector(const ChunkedXvector &other)
+    : ChunkedXvector(alloc_traits::select_on_container_copy_construction(other.alloc))
+{
+    reserve(other.chunked_size);
+    other.for_each_chunk([&](const T *first, const T *last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    });
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+ChunkedXvector<T, ChunkSize, Alloc>::ChunkedXvector(ChunkedXvector &&other) noexcept
+    : alloc(other.alloc), table(std::move(other.table)), chunked_size(other.chunked_size)
+{
+    other.chunked_size = 0;
+    other.table.push_back(nullptr);
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+ChunkedXvector<T, ChunkSize, Alloc> &ChunkedXvector<T, ChunkSize, Alloc>::operator=(const ChunkedXvector &other)
+{
+    if (this == &other)
+        return *this;
+    destroy_all(chunk_total()); // Keep the chunks for the copy
+    reserve(other.chunked_size);
+    other.for_each_chunk([&](const T *first, const T *last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    });
+    return *this;
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+ChunkedXvector<T, ChunkSize, Alloc> &ChunkedXvector<T, ChunkSize, Alloc>::operator=(ChunkedXvector &&other) noexcept
+{
+    if (this == &other)
+        return *this;
+    ChunkedXvector tmp(std::move(other));
+    std::swap(alloc, tmp.alloc);
+    table.swap(tmp.table);
+    std::swap(chunked_size, tmp.chunked_size);
+    return *this;
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline ChunkedXvector<T, ChunkSize, Alloc>::~ChunkedXvector()
+{
+    destroy_all(0);
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline bool ChunkedXvector<T, ChunkSize, Alloc>::empty() const
+{
+    return !chunked_size;
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline size_t ChunkedXvector<T, ChunkSize, Alloc>::size() const
+{
+    return chunked_size;
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline size_t ChunkedXvector<T, ChunkSize, Alloc>::capacity() const
+{
+    return chunk_total() * ChunkSize;
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+void ChunkedXvector<T, ChunkSize, Alloc>::reserve(size_t new_capacity)
+{
+    size_t chunks = (new_capacity + ChunkSize - 1) >> chunk_bits;
+    if (chunks > chunk_total())
+        table.reserve(chunks + 1);
+    while (chunk_total() < chunks)
+        add_chunk();
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+void ChunkedXvector<T, ChunkSize, Alloc>::shrink_to_fit()
+{
+    size_t used = (chunked_size + ChunkSize - 1) >> chunk_bits;
+    while (chunk_total() > used)
+    {
+        alloc_traits::deallocate(alloc, table[table.size() - 2], ChunkSize);
+        table.pop_back();
+        table[table.size() - 1] = nullptr;
+    }
+    table.shrink_to_fit();
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline void ChunkedXvector<T, ChunkSize, Alloc>::push_back(const T &x)
+{
+    emplace_back(x);
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline void ChunkedXvector<T, ChunkSize, Alloc>::push_back(T &&x)
+{
+    emplace_back(std::move(x));
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+template <typename... Args>
+inline T &ChunkedXvector<T, ChunkSize, Alloc>::emplace_back(Args &&...args)
+{
+    if (chunked_size == capacity())
+        add_chunk(); // Nothing moves: only the table of pointers may grow
+    T *slot = table[chunked_size >> chunk_bits] + (chunked_size & (ChunkSize - 1));
+    alloc_traits::construct(alloc, slot, std::forward<Args>(args)...);
+    chunked_size++;
+    return *slot;
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline void ChunkedXvector<T, ChunkSize, Alloc>::pop_back()
+{
+    if (!chunked_size)
+        return;
+    chunked_size--;
+    alloc_traits::destroy(alloc, &(*this)[chunked_size]);
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline void ChunkedXvector<T, ChunkSize, Alloc>::clear()
+{
+    destroy_all(0);
+    table.shrink_to_fit();
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline T &ChunkedXvector<T, ChunkSize, Alloc>::operator[](size_t pos)
+{
+    return table[pos >> chunk_bits][pos & (ChunkSize - 1)];
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline const T &ChunkedXvector<T, ChunkSize, Alloc>::operator[](size_t pos) const
+{
+    return table[pos >> chunk_bits][pos & (ChunkSize - 1)];
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline T &ChunkedXvector<T, ChunkSize, Alloc>::at(size_t pos)
+{
+    if (pos >= chunked_size)
+        throw out_of_range("ChunkedXvector::at: index out of range");
+    return (*this)[pos];
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline const T &ChunkedXvector<T, ChunkSize, Alloc>::at(size_t pos) const
+{
+    if (pos >= chunked_size)
+        throw out_of_range("ChunkedXvector::at: index out of range");
+    return (*this)[pos];
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline T &ChunkedXvector<T, ChunkSize, Alloc>::back()
+{
+    return (*this)[chunked_size - 1];
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+template <typename Fn>
+void ChunkedXvector<T, ChunkSize, Alloc>::for_each_chunk(Fn fn)
+{
+    size_t left = chunked_size;
+    for (size_t c = 0; left; c++)
+    {
+        size_t n = left < ChunkSize ? left : ChunkSize;
+        fn(table[c], table[c] + n);
+        left -= n;
+    }
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+template <typename Fn>
+void ChunkedXvector<T, ChunkSize, Alloc>::for_each_chunk(Fn fn) const
+{
+    size_t left = chunked_size;
+    for (size_t c = 0; left; c++)
+    {
+        size_t n = left < ChunkSize ? left : ChunkSize;
+        fn(static_cast<const T *>(table[c]), static_cast<const T *>(table[c] + n));
+        left -= n;
+    }
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline typename ChunkedXvector<T, ChunkSize, Alloc>::iterator ChunkedXvector<T, ChunkSize, Alloc>::begin()
+{
+    return iterator(table.begin(), table[0]);
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline typename ChunkedXvector<T, ChunkSize, Alloc>::const_iterator ChunkedXvector<T, ChunkSize, Alloc>::begin() const
+{
+    return const_iterator(table.begin(), table[0]);
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline typename ChunkedXvector<T, ChunkSize, Alloc>::iterator ChunkedXvector<T, ChunkSize, Alloc>::end()
+{
+    T *const *node = table.begin() + (chunked_size >> chunk_bits);
+    return iterator(node, *node + (chunked_size & (ChunkSize - 1)));
+}
+
+template <typename T, size_t ChunkSize, typename Alloc>
+inline typename ChunkedXvector<T, ChunkSize, Alloc>::const_iterator ChunkedXvector<T, ChunkSize, Alloc>::end() const
+{
+    T *const *node = table.begin() + (chunked_size >> chunk_bits);
+    return const_iterator(node, *node + (chunked_size & (ChunkSize - 1)));
+}
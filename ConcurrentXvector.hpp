@@ -0,0 +1,437 @@
+/**
+ * @file ConcurrentXvector.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief An append-only vector that many threads can push_back into at once
+ *        without a lock. Slots are claimed with one atomic fetch_add and live
+ *        in buckets whose sizes double, so elements never move once built;
+ *        only allocating a new bucket takes a mutex.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <atomic>      // for atomic
+#include <cstddef>     // for size_t, ptrdiff_t
+#include <iterator>    // for random_access_iterator_tag
+#include <memory>      // for allocator, allocator_traits
+#include <mutex>       // for mutex, lock_guard
+#include <stdexcept>   // for basic exceptions
+#include <type_traits> // for is_nothrow_move_constructible
+#include <utility>     // for forward, move
+#include "Xvector.hpp"
+using namespace std;
+
+/**
+ * @brief An append-only vector that is safe to push_back into from several
+ *        threads at once. Bucket b holds FirstBucket << b elements, so the
+ *        bucket and offset of an index come from its highest set bit and the
+ *        buckets never need to be copied. References and iterators stay valid
+ *        until the vector is destroyed.
+ *
+ *        size() counts every claimed slot, including ones another thread is
+ *        still constructing. A thread may read the element whose index its
+ *        own push_back returned; other elements may be read once the threads
+ *        that pushed them have been joined, or otherwise synchronized with.
+ *
+ *        Buckets are allocated under a mutex, so the allocator is only ever
+ *        used by one thread at a time and need not be thread-safe itself,
+ *        e.g. an xarena_allocator. The arena must not be used by anything
+ *        else while threads push into the vector.
+ *
+ * @tparam T type of element, must be nothrow move constructible.
+ * @tparam Alloc type of allocator, default is std::allocator<T>
+ * @tparam FirstBucket number of elements in the first bucket, a power of two,
+ *         default is 64.
+ */
+template <typename T, typename Alloc = std::allocator<T>, size_t FirstBucket = 64>
+class ConcurrentXvector
+{
+    static_assert(FirstBucket && !(FirstBucket & (FirstBucket - 1)), "FirstBucket must be a power of two");
+    static_assert(is_nothrow_move_constructible<T>::value, "ConcurrentXvector requires a nothrow move constructor");
+
+private:
+    static constexpr size_t first_bits = xvector_log2(FirstBucket);
+    static constexpr size_t max_buckets = 64 - first_bits;
+
+    using alloc_traits = allocator_traits<Alloc>;
+
+    Alloc alloc;                           // Allocator for buckets
+    mutex grow;                            // Held while a bucket is allocated
+    alignas(64) atomic<size_t> claimed{0}; // Number of slots handed out, on its own cache line
+    alignas(64) atomic<T *> buckets[max_buckets]{}; // Bucket b holds FirstBucket << b elements
+
+    /**
+     * @brief Returns the number of elements in a bucket.
+     *
+     * @param b Index of the bucket.
+     * @return size_t
+     */
+    static size_t bucket_size(size_t b);
+
+    /**
+     * @brief Splits an element index into its bucket and offset.
+     *
+     * @param pos Index of the element.
+     * @param b Set to the index of the bucket.
+     * @return size_t offset within the bucket.
+     */
+    static size_t locate(size_t pos, size_t &b);
+
+    /**
+     * @brief Returns a bucket, allocating it if no thread has yet. Once a
+     *        bucket exists this is a single load; allocation happens under
+     *        the grow mutex, and threads that wait on it find the bucket the
+     *        first one stored. Running out of memory here terminates, since
+     *        the caller's slot is already claimed and cannot be handed back.
+     *
+     * @param b Index of the bucket.
+     * @return T* pointer to the bucket.
+     */
+    T *bucket(size_t b) noexcept;
+
+public:
+    /**
+     * @brief Random access iterator over the elements, by index.
+     *
+     * @tparam Const true for a const_iterator.
+     */
+    template <bool Const>
+    class basic_iterator
+    {
+    private:
+        using owner = conditional_t<Const, const ConcurrentXvector, ConcurrentXvector>;
+        owner *vec{nullptr};
+        size_t pos{0};
+
+    public:
+        using iterator_category = random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = conditional_t<Const, const T *, T *>;
+        using reference = conditional_t<Const, const T &, T &>;
+
+        basic_iterator() {}
+        basic_iterator(owner *_vec, size_t _pos) : vec(_vec), pos(_pos) {}
+        operator basic_iterator<true>() const { return basic_iterator<true>(vec, pos); }
+
+        reference operator*() const { return (*vec)[pos]; }
+        pointer operator->() const { return &(*vec)[pos]; }
+        reference operator[](difference_type n) const { return (*vec)[pos + n]; }
+
+        basic_iterator &operator++() { pos++; return *this; }
+        basic_iterator operator++(int) { basic_iterator tmp = *this; pos++; return tmp; }
+        basic_iterator &operator--() { pos--; return *this; }
+        basic_iterator operator--(int) { basic_iterator tmp = *this; pos--; return tmp; }
+        basic_iterator &operator+=(difference_type n) { pos += n; return *this; }
+        basic_iterator &operator-=(difference_type n) { pos -= n; return *this; }
+        basic_iterator operator+(difference_type n) const { return basic_iterator(vec, pos + n); }
+        basic_iterator operator-(difference_type n) const { return basic_iterator(vec, pos - n); }
+        difference_type operator-(const basic_iterator &other) const { return difference_type(pos) - difference_type(other.pos); }
+
+        bool operator==(const basic_iterator &other) const { return pos == other.pos; }
+        bool operator!=(const basic_iterator &other) const { return pos != other.pos; }
+        bool operator<(const basic_iterator &other) const { return pos < other.pos; }
+        bool operator>(const basic_iterator &other) const { return pos > other.pos; }
+        bool operator<=(const basic_iterator &other) const { return pos <= other.pos; }
+        bool operator>=(const basic_iterator &other) const { return pos >= other.pos; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using allocator_type = Alloc;
+
+    /**
+     * @brief Construct a new ConcurrentXvector object. No memory is allocated
+     *        until the first push_back.
+     *
+     * @param a Allocator to be copied.
+     */
+    explicit ConcurrentXvector(const Alloc &a = Alloc());
+
+    /**
+     * @brief Destroys every element and frees the buckets. No other thread
+     *        may be using the vector.
+     *
+     */
+    ~ConcurrentXvector();
+
+    ConcurrentXvector(const ConcurrentXvector &) = delete;
+    ConcurrentXvector &operator=(const ConcurrentXvector &) = delete;
+
+    /**
+     * @brief Allocates the buckets needed to hold the given number of
+     *        elements, so pushes up to that count never allocate. Safe to
+     *        call while other threads push.
+     *
+     * @param new_capacity Number of elements.
+     */
+    void reserve(size_t new_capacity);
+
+    /**
+     * @brief Appends an element. Safe to call from several threads at once.
+     *
+     * @param x The element to be appended.
+     * @return size_t index of the new element.
+     */
+    size_t push_back(const T &x);
+
+    /**
+     * @brief Appends an element. Safe to call from several threads at once.
+     *
+     * @param x The element to be appended.
+     * @return size_t index of the new element.
+     */
+    size_t push_back(T &&x);
+
+    /**
+     * @brief Constructs an element from the given arguments and appends it.
+     *        The element is built before a slot is claimed, so a throwing
+     *        constructor leaves the vector unchanged. Safe to call from
+     *        several threads at once.
+     *
+     * @tparam Args types of the constructor arguments.
+     * @param args Arguments forwarded to the constructor of T.
+     * @return size_t index of the new element.
+     */
+    template <typename... Args>
+    size_t emplace_back(Args &&...args);
+
+    /**
+     * @brief Tests if no slot has been claimed.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of claimed slots, which may include elements
+     *        still under construction by other threads.
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns a reference to the element at the given index.
+     *
+     * @param pos Index of the element.
+     * @return T&
+     */
+    T &operator[](size_t pos);
+
+    /**
+     * @brief Returns a constant reference to the element at the given index.
+     *
+     * @param pos Index of the element.
+     * @return const T&
+     */
+    const T &operator[](size_t pos) const;
+
+    /**
+     * @brief Returns a reference to the element at the given index. Throws
+     *        std::out_of_range if the index is not below size().
+     *
+     * @param pos Index of the element.
+     * @return T&
+     */
+    T &at(size_t pos);
+
+    /**
+     * @brief Returns a constant reference to the element at the given index.
+     *        Throws std::out_of_range if the index is not below size().
+     *
+     * @param pos Index of the element.
+     * @return const T&
+     */
+    const T &at(size_t pos) const;
+
+    /**
+     * @brief Returns an iterator to the first element.
+     *
+     * @return iterator
+     */
+    iterator begin();
+
+    /**
+     * @brief Returns a constant iterator to the first element.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns an iterator one past the last claimed slot, as of the
+     *        call.
+     *
+     * @return iterator
+     */
+    iterator end();
+
+    /**
+     * @brief Returns a constant iterator one past the last claimed slot, as
+     *        of the call.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const;
+};
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline size_t ConcurrentXvector<T, Alloc, FirstBucket>::bucket_size(size_t b)
+{
+    return FirstBucket << b;
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline size_t ConcurrentXvector<T, Alloc, FirstBucket>::locate(size_t pos, size_t &b)
+{
+    size_t biased = pos + FirstBucket; // Bucket b covers [FirstBucket << b, FirstBucket << (b + 1)) after the bias
+    size_t high = xvector_high_bit(biased);
+    b = high - first_bits;
+    return biased - (size_t(1) << high);
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+T *ConcurrentXvector<T, Alloc, FirstBucket>::bucket(size_t b) noexcept
+{
+    T *p = buckets[b].load(memory_order_acquire);
+    if (p)
+        return p;
+    lock_guard<mutex> lock(grow); // The allocator may not be thread-safe
+    p = buckets[b].load(memory_order_acquire);
+    if (!p) // Otherwise another thread allocated it while this one waited
+    {
+        p = alloc_traits::allocate(alloc, bucket_size(b));
+        buckets[b].store(p, memory_order_release);
+    }
+    return p;
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline ConcurrentXvector<T, Alloc, FirstBucket>::ConcurrentXvector(const Alloc &a) : alloc(a)
+{
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+ConcurrentXvector<T, Alloc, FirstBucket>::~ConcurrentXvector()
+{
+    size_t remaining = claimed.load(memory_order_acquire);
+    for (size_t b = 0; b < max_buckets; b++)
+    {
+        T *p = buckets[b].load(memory_order_acquire);
+        if (!p)
+            continue;
+        size_t count = remaining < bucket_size(b) ? remaining : bucket_size(b);
+        for (size_t i = 0; i < count; i++)
+            alloc_traits::destroy(alloc, p + i);
+        remaining -= count;
+        alloc_traits::deallocate(alloc, p, bucket_size(b));
+    }
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+void ConcurrentXvector<T, Alloc, FirstBucket>::reserve(size_t new_capacity)
+{
+    if (!new_capacity)
+        return;
+    size_t last;
+    locate(new_capacity - 1, last);
+    for (size_t b = 0; b <= last; b++)
+        bucket(b);
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline size_t ConcurrentXvector<T, Alloc, FirstBucket>::push_back(const T &x)
+{
+    return emplace_back(x);
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline size_t ConcurrentXvector<T, Alloc, FirstBucket>::push_back(T &&x)
+{
+    return emplace_back(std::move(x));
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+template <typename... Args>
+size_t ConcurrentXvector<T, Alloc, FirstBucket>::emplace_back(Args &&...args)
+{
+    T tmp(std::forward<Args>(args)...); // May throw; nothing is claimed yet
+    size_t pos = claimed.fetch_add(1, memory_order_relaxed);
+    size_t b;
+    size_t offset = locate(pos, b);
+    alloc_traits::construct(alloc, bucket(b) + offset, std::move(tmp));
+    return pos;
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline bool ConcurrentXvector<T, Alloc, FirstBucket>::empty() const
+{
+    return !size();
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline size_t ConcurrentXvector<T, Alloc, FirstBucket>::size() const
+{
+    return claimed.load(memory_order_acquire);
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline T &ConcurrentXvector<T, Alloc, FirstBucket>::operator[](size_t pos)
+{
+    size_t b;
+    size_t offset = locate(pos, b);
+    return buckets[b].load(memory_order_acquire)[offset];
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline const T &ConcurrentXvector<T, Alloc, FirstBucket>::operator[](size_t pos) const
+{
+    size_t b;
+    size_t offset = locate(pos, b);
+    return buckets[b].load(memory_order_acquire)[offset];
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline T &ConcurrentXvector<T, Alloc, FirstBucket>::at(size_t pos)
+{
+    if (pos >= size())
+        throw out_of_range("ConcurrentXvector::at: index out of range");
+    return (*this)[pos];
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline const T &ConcurrentXvector<T, Alloc, FirstBucket>::at(size_t pos) const
+{
+    if (pos >= size())
+        throw out_of_range("ConcurrentXvector::at: index out of range");
+    return (*this)[pos];
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline typename ConcurrentXvector<T, Alloc, FirstBucket>::iterator ConcurrentXvector<T, Alloc, FirstBucket>::begin()
+{
+    return iterator(this, 0);
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline typename ConcurrentXvector<T, Alloc, FirstBucket>::const_iterator ConcurrentXvector<T, Alloc, FirstBucket>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline typename ConcurrentXvector<T, Alloc, FirstBucket>::iterator ConcurrentXvector<T, Alloc, FirstBucket>::end()
+{
+    return iterator(this, size());
+}
+
+template <typename T, typename Alloc, size_t FirstBucket>
+inline typename ConcurrentXvector<T, Alloc, FirstBucket>::const_iterator ConcurrentXvector<T, Alloc, FirstBucket>::end() const
+{
+    return const_iterator(this, size());
+}
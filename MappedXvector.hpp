@@ -0,0 +1,450 @@
+/**
+ * @file MappedXvector.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief A vector of trivially copyable elements that lives in a file mapped
+ *        into memory. Elements are written straight into the mapping, and
+ *        reopening the file maps it again without reading or parsing it, so
+ *        startup takes the same time whatever the size of the data.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t
+#include <cstring>     // for memcmp, memcpy, memset
+#include <stdexcept>   // for basic exceptions
+#include <string>      // for string
+#include <type_traits> // for is_trivially_copyable
+#include <fcntl.h>     // for open
+#include <sys/mman.h>  // for mmap, mremap, munmap, msync
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close, ftruncate
+using namespace std;
+
+/**
+ * @brief A growable array of T backed by a file. The file starts with a
+ *        64-byte header holding a magic string, sizeof(T) and the element
+ *        count, followed by the elements themselves, so the file is the
+ *        in-memory layout and can be mapped back as is. Growing extends the
+ *        file with ftruncate and the mapping with mremap where available.
+ *
+ *        The data is only as portable as T's layout: reopen a file with the
+ *        same T on a machine of the same byte order. Throws
+ *        std::runtime_error if the file cannot be opened, mapped or grown, or
+ *        holds something else.
+ *
+ * @tparam T type of element, must be trivially copyable.
+ */
+template <typename T>
+class MappedXvector
+{
+    static_assert(is_trivially_copyable<T>::value, "MappedXvector requires a trivially copyable type");
+    static_assert(alignof(T) <= 64, "MappedXvector elements are stored 64-byte aligned");
+
+private:
+    /**
+     * @brief Layout of the start of the file.
+     *
+     */
+    struct header
+    {
+        char magic[8];      // "XVECMAP1"
+        uint64_t elem_size; // sizeof(T) when the file was created
+        uint64_t size;      // Number of elements
+        uint64_t unused[5]; // Pads the header to 64 bytes
+    };
+    static_assert(sizeof(header) == 64, "header must stay 64 bytes");
+
+    int fd{-1};                // Open file
+    header *head{nullptr};     // Start of the mapping
+    size_t mapped_bytes{0};    // Length of the mapping and of the file
+    size_t mapped_capacity{0}; // Number of elements the file can hold
+
+    /**
+     * @brief Returns a pointer to the first element.
+     *
+     * @return T*
+     */
+    T *elems() const;
+
+    /**
+     * @brief Resizes the file and the mapping to hold the given number of
+     *        elements. New elements read as zero bytes.
+     *
+     * @param new_capacity Number of elements.
+     */
+    void remap(size_t new_capacity);
+
+public:
+    using iterator = T *;
+    using const_iterator = T const *;
+
+    /**
+     * @brief Opens the file at the given path, creating it if it does not
+     *        exist. An existing file is mapped, not read.
+     *
+     * @param path Path of the file.
+     */
+    explicit MappedXvector(const char *path);
+
+    /**
+     * @brief Unmaps and closes the file. The elements stay in the file.
+     *
+     */
+    ~MappedXvector();
+
+    MappedXvector(const MappedXvector &) = delete;
+    MappedXvector &operator=(const MappedXvector &) = delete;
+
+    /**
+     * @brief Tests if the vector is empty.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the current number of elements in the vector.
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the number of elements the file can hold before it must
+     *        be grown.
+     *
+     * @return size_t
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Grows the file to hold at least the given number of elements.
+     *
+     * @param new_capacity Minimum capacity of the vector.
+     */
+    void reserve(size_t new_capacity);
+
+    /**
+     * @brief Truncates the file to the current number of elements.
+     *
+     */
+    void shrink_to_fit();
+
+    /**
+     * @brief Inserts an element at the end of the vector.
+     *
+     * @param x The value to be inserted.
+     */
+    void push_back(const T &x);
+
+    /**
+     * @brief Decreases the size of the vector by 1.
+     *
+     */
+    void pop_back();
+
+    /**
+     * @brief Resizes the vector. New elements are zero bytes.
+     *
+     * @param new_size New size of the vector.
+     */
+    void resize(size_t new_size);
+
+    /**
+     * @brief Erases all elements. The file keeps its capacity.
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Writes modified pages back to the file and waits for the write
+     *        to finish. Only needed for durability against a crash of the
+     *        machine; other processes see the data through the page cache.
+     *
+     */
+    void sync();
+
+    /**
+     * @brief Returns a reference to the element at the given index.
+     *
+     * @param pos Index of the element.
+     * @return T&
+     */
+    T &operator[](size_t pos);
+
+    /**
+     * @brief Returns a constant reference to the element at the given index.
+     *
+     * @param pos Index of the element.
+     * @return const T&
+     */
+    const T &operator[](size_t pos) const;
+
+    /**
+     * @brief Returns a reference to the element at the given index. Throws
+     *        std::out_of_range if the index is not within the vector.
+     *
+     * @param pos Index of the element.
+     * @return T&
+     */
+    T &at(size_t pos);
+
+    /**
+     * @brief Returns a constant reference to the element at the given index.
+     *        Throws std::out_of_range if the index is not within the vector.
+     *
+     * @param pos Index of the element.
+     * @return const T&
+     */
+    const T &at(size_t pos) const;
+
+    /**
+     * @brief Returns an iterator to the first element in the vector.
+     *
+     * @return iterator
+     */
+    iterator begin();
+
+    /**
+     * @brief Returns a constant iterator to the first element in the vector.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns an iterator to the element one past the last element in
+     *        the vector.
+     *
+     * @return iterator
+     */
+    iterator end();
+
+    /**
+     * @brief Returns a constant iterator to the element one past the last
+     *        element in the vector.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const;
+};
+
+template <typename T>
+inline T *MappedXvector<T>::elems() const
+{
+    return reinterpret_cast<T *>(head + 1);
+}
+
+template <typename T>
+void MappedXvector<T>::remap(size_t new_capacity)
+{
+    size_t new_bytes = sizeof(header) + new_capacity * sizeof(T);
+    if (ftruncate(fd, static_cast<off_t>(new_bytes)) != 0) // Extended bytes read as zero
+        throw runtime_error("MappedXvector: cannot resize file");
+
+    void *p;
+#ifdef MREMAP_MAYMOVE
+    p = mremap(head, mapped_bytes, new_bytes, MREMAP_MAYMOVE); // The kernel moves page tables, not data
+#else
+    p = mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p != MAP_FAILED)
+        munmap(head, mapped_bytes);
+#endif
+    if (p == MAP_FAILED) // The old mapping is still intact
+    {
+        int restored = ftruncate(fd, static_cast<off_t>(mapped_bytes)); // Best effort, a longer file is harmless
+        (void)restored;
+        throw runtime_error("MappedXvector: cannot map file");
+    }
+    head = static_cast<header *>(p);
+    mapped_bytes = new_bytes;
+    mapped_capacity = new_capacity;
+}
+
+template <typename T>
+MappedXvector<T>::MappedXvector(const char *path)
+{
+    fd = ::open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+        throw runtime_error(string("MappedXvector: cannot open ") + path);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        throw runtime_error(string("MappedXvector: cannot stat ") + path);
+    }
+
+    bool fresh = st.st_size == 0;
+    size_t bytes = fresh ? 4096 : static_cast<size_t>(st.st_size);
+    if (bytes < sizeof(header) || (fresh && ftruncate(fd, static_cast<off_t>(bytes)) != 0))
+    {
+        ::close(fd);
+        throw runtime_error(string("MappedXvector: bad file ") + path);
+    }
+
+    void *p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0); // No MAP_POPULATE: pages fault in on use
+    if (p == MAP_FAILED)
+    {
+        ::close(fd);
+        throw runtime_error(string("MappedXvector: cannot map ") + path);
+    }
+    head = static_cast<header *>(p);
+    mapped_bytes = bytes;
+    mapped_capacity = (bytes - sizeof(header)) / sizeof(T);
+
+    if (fresh)
+    {
+        memcpy(head->magic, "XVECMAP1", 8);
+        head->elem_size = sizeof(T);
+        head->size = 0;
+    }
+    else if (memcmp(head->magic, "XVECMAP1", 8) != 0 || head->elem_size != sizeof(T) ||
+             head->size > mapped_capacity)
+    {
+        munmap(head, mapped_bytes);
+        ::close(fd);
+        throw runtime_error(string("MappedXvector: not a matching file ") + path);
+    }
+}
+
+template <typename T>
+MappedXvector<T>::~MappedXvector()
+{
+    if (head)
+        munmap(head, mapped_bytes);
+    ::close(fd);
+}
+
+template <typename T>
+inline bool MappedXvector<T>::empty() const
+{
+    return !head->size;
+}
+
+template <typename T>
+inline size_t MappedXvector<T>::size() const
+{
+    return head->size;
+}
+
+template <typename T>
+inline size_t MappedXvector<T>::capacity() const
+{
+    return mapped_capacity;
+}
+
+template <typename T>
+void MappedXvector<T>::reserve(size_t new_capacity)
+{
+    if (new_capacity > mapped_capacity)
+        remap(new_capacity);
+}
+
+template <typename T>
+void MappedXvector<T>::shrink_to_fit()
+{
+    if (head->size < mapped_capacity)
+        remap(head->size);
+}
+
+template <typename T>
+inline void MappedXvector<T>::push_back(const T &x)
+{
+    if (head->size == mapped_capacity)
+    {
+        T tmp(x); // x may live in the mapping that is about to move
+        remap(mapped_capacity ? mapped_capacity * 2 : 4096 / sizeof(T) + 1);
+        elems()[head->size++] = tmp;
+        return;
+    }
+    elems()[head->size++] = x;
+}
+
+template <typename T>
+inline void MappedXvector<T>::pop_back()
+{
+    if (head->size)
+        head->size--;
+}
+
+template <typename T>
+void MappedXvector<T>::resize(size_t new_size)
+{
+    if (new_size > mapped_capacity)
+        remap(new_size);
+    if (new_size > head->size) // Earlier elements past the size may have left bytes behind
+        memset(static_cast<void *>(elems() + head->size), 0, (new_size - head->size) * sizeof(T));
+    head->size = new_size;
+}
+
+template <typename T>
+inline void MappedXvector<T>::clear()
+{
+    head->size = 0;
+}
+
+template <typename T>
+void MappedXvector<T>::sync()
+{
+    if (msync(head, mapped_bytes, MS_SYNC) != 0)
+        throw runtime_error("MappedXvector: sync failed");
+}
+
+template <typename T>
+inline T &MappedXvector<T>::operator[](size_t pos)
+{
+    return elems()[pos];
+}
+
+template <typename T>
+inline const T &MappedXvector<T>::operator[](size_t pos) const
+{
+    return elems()[pos];
+}
+
+template <typename T>
+inline T &MappedXvector<T>::at(size_t pos)
+{
+    if (pos >= head->size)
+        throw out_of_range("MappedXvector::at: index out of range");
+    return elems()[pos];
+}
+
+template <typename T>
+inline const T &MappedXvector<T>::at(size_t pos) const
+{
+    if (pos >= head->size)
+        throw out_of_range("MappedXvector::at: index out of range");
+    return elems()[pos];
+}
+
+template <typename T>
+inline typename MappedXvector<T>::iterator MappedXvector<T>::begin()
+{
+    return elems();
+}
+
+template <typename T>
+inline typename MappedXvector<T>::const_iterator MappedXvector<T>::begin() const
+{
+    return elems();
+}
+
+template <typename T>
+inline typename MappedXvector<T>::iterator MappedXvector<T>::end()
+{
+    return elems() + head->size;
+}
+
+template <typename T>
+inline typename MappedXvector<T>::const_iterator MappedXvector<T>::end() const
+{
+    return elems() + head->size;
+}
@@ -0,0 +1,281 @@
+/**
+ * @file Xarena.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief A monotonic arena and allocators that draw from it, usable as the
+ *        Alloc parameter of Xvector. Everything allocated from an arena is
+ *        released at once by reset() or by the arena's destructor.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>   // for size_t, max_align_t
+#include <cstdint>   // for uintptr_t
+#include <new>       // for operator new, bad_alloc
+#include <stdexcept> // for basic exceptions
+using namespace std;
+
+/**
+ * @brief A bump allocator. Memory comes from a list of chunks that double in
+ *        size; allocating is a pointer increment and deallocating is a no-op.
+ *        reset() makes every chunk but the largest available again in time
+ *        proportional to the number of chunks, not the number of allocations.
+ *
+ */
+class Xarena
+{
+private:
+    struct chunk
+    {
+        chunk *next;  // Previously filled chunk
+        size_t bytes; // Usable bytes following this header
+    };
+
+    chunk *head{nullptr};      // Chunk currently being filled
+    char *cur{nullptr};        // Next free byte in head
+    char *stop{nullptr};       // One past the last usable byte in head
+    size_t next_chunk_bytes;   // Size of the next chunk to allocate
+    size_t allocations{0};     // Number of calls to allocate since reset
+    size_t bytes_requested{0}; // Bytes handed out since reset
+    size_t chunk_count{0};     // Number of chunks currently owned
+
+    /**
+     * @brief Allocates a new chunk large enough for the given request.
+     *
+     * @param bytes Size of the request.
+     * @param align Alignment of the request.
+     */
+    void add_chunk(size_t bytes, size_t align);
+
+public:
+    /**
+     * @brief Construct a new Xarena object. No memory is allocated until the
+     *        first request.
+     *
+     * @param initial_chunk_bytes Size of the first chunk, default is 64 KiB.
+     */
+    explicit Xarena(size_t initial_chunk_bytes = 64 * 1024);
+
+    /**
+     * @brief Destroy the Xarena object, returning every chunk to the system.
+     *
+     */
+    ~Xarena();
+
+    Xarena(const Xarena &) = delete;
+    Xarena &operator=(const Xarena &) = delete;
+
+    /**
+     * @brief Returns a block of memory with the given size and alignment.
+     *
+     * @param bytes Size of the block.
+     * @param align Alignment of the block, a power of two.
+     * @return void* pointer to the block.
+     */
+    void *allocate(size_t bytes, size_t align = alignof(max_align_t));
+
+    /**
+     * @brief Does nothing; memory is reclaimed by reset().
+     *
+     * @param p Pointer to the block.
+     * @param bytes Size of the block.
+     */
+    void deallocate(void *p, size_t bytes);
+
+    /**
+     * @brief Releases everything allocated from the arena. Keeps the largest
+     *        chunk for reuse and frees the others. Objects still living in the
+     *        arena must not be used afterwards.
+     *
+     */
+    void reset();
+
+    /**
+     * @brief Returns the number of calls to allocate since the last reset.
+     *
+     * @return size_t
+     */
+    size_t allocation_count() const;
+
+    /**
+     * @brief Returns the number of bytes handed out since the last reset.
+     *
+     * @return size_t
+     */
+    size_t bytes_allocated() const;
+
+    /**
+     * @brief Returns the number of chunks the arena owns.
+     *
+     * @return size_t
+     */
+    size_t chunks() const;
+};
+
+inline Xarena::Xarena(size_t initial_chunk_bytes) : next_chunk_bytes(initial_chunk_bytes ? initial_chunk_bytes : 1) {}
+
+inline Xarena::~Xarena()
+{
+    while (head)
+    {
+        chunk *next = head->next;
+        ::operator delete(head);
+        head = next;
+    }
+}
+
+inline void Xarena::add_chunk(size_t bytes, size_t align)
+{
+    size_t needed = bytes + align; // Room to align the first request
+    while (next_chunk_bytes < needed)
+        next_chunk_bytes *= 2;
+
+    chunk *c = static_cast<chunk *>(::operator new(sizeof(chunk) + next_chunk_bytes));
+    c->next = head;
+    c->bytes = next_chunk_bytes;
+    head = c;
+    cur = reinterpret_cast<char *>(c + 1);
+    stop = cur + c->bytes;
+    chunk_count++;
+    next_chunk_bytes *= 2; // Chunks double so the chunk count stays logarithmic
+}
+
+inline void *Xarena::allocate(size_t bytes, size_t align)
+{
+    uintptr_t p = (reinterpret_cast<uintptr_t>(cur) + align - 1) & ~(uintptr_t)(align - 1);
+    if (!head || p + bytes > reinterpret_cast<uintptr_t>(stop))
+    {
+        add_chunk(bytes, align);
+        p = (reinterpret_cast<uintptr_t>(cur) + align - 1) & ~(uintptr_t)(align - 1);
+    }
+    cur = reinterpret_cast<char *>(p + bytes);
+    allocations++;
+    bytes_requested += bytes;
+    return reinterpret_cast<void *>(p);
+}
+
+inline void Xarena::deallocate(void *p, size_t bytes)
+{
+    (void)p;
+    (void)bytes;
+}
+
+inline void Xarena::reset()
+{
+    if (!head)
+        return;
+
+    chunk *largest = head; // Chunks double, so the newest is the largest
+    chunk *c = head->next;
+    while (c)
+    {
+        chunk *next = c->next;
+        ::operator delete(c);
+        c = next;
+    }
+    largest->next = nullptr;
+    cur = reinterpret_cast<char *>(largest + 1);
+    stop = cur + largest->bytes;
+    chunk_count = 1;
+    allocations = bytes_requested = 0;
+}
+
+inline size_t Xarena::allocation_count() const { return allocations; }
+
+inline size_t Xarena::bytes_allocated() const { return bytes_requested; }
+
+inline size_t Xarena::chunks() const { return chunk_count; }
+
+/**
+ * @brief Allocator that draws from a given Xarena. Copies, including rebound
+ *        ones, share the arena and compare equal. The arena must outlive every
+ *        container using it.
+ *
+ * @tparam T type of element.
+ */
+template <typename T>
+class xarena_allocator
+{
+private:
+    Xarena *arena;
+
+    template <typename U>
+    friend class xarena_allocator;
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Construct a new xarena allocator drawing from the given arena.
+     *
+     * @param a Arena to allocate from.
+     */
+    xarena_allocator(Xarena &a) : arena(&a) {}
+
+    template <typename U>
+    xarena_allocator(const xarena_allocator<U> &other) : arena(other.arena) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T))); }
+
+    void deallocate(T *p, size_t n) { arena->deallocate(p, n * sizeof(T)); }
+
+    /**
+     * @brief Returns the arena this allocator draws from.
+     *
+     * @return Xarena&
+     */
+    Xarena &resource() const { return *arena; }
+
+    template <typename U>
+    bool operator==(const xarena_allocator<U> &other) const { return arena == other.arena; }
+
+    template <typename U>
+    bool operator!=(const xarena_allocator<U> &other) const { return arena != other.arena; }
+};
+
+/**
+ * @brief Returns the calling thread's own arena, created on first use and
+ *        freed when the thread exits.
+ *
+ * @return Xarena&
+ */
+inline Xarena &xarena_thread_local()
+{
+    thread_local Xarena arena;
+    return arena;
+}
+
+/**
+ * @brief Stateless allocator that draws from the calling thread's arena, so
+ *        it can be default constructed, e.g. by nested containers such as
+ *        strings inside an Xvector. Call xarena_thread_local().reset() at the
+ *        end of a request to drop everything at once. Memory must not outlive
+ *        the reset or be used by containers that grow on another thread.
+ *
+ * @tparam T type of element.
+ */
+template <typename T>
+class xarena_thread_allocator
+{
+public:
+    using value_type = T;
+
+    xarena_thread_allocator() {}
+
+    template <typename U>
+    xarena_thread_allocator(const xarena_thread_allocator<U> &) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(xarena_thread_local().allocate(n * sizeof(T), alignof(T))); }
+
+    void deallocate(T *p, size_t n) { xarena_thread_local().deallocate(p, n * sizeof(T)); }
+
+    template <typename U>
+    bool operator==(const xarena_thread_allocator<U> &) const { return true; }
+
+    template <typename U>
+    bool operator!=(const xarena_thread_allocator<U> &) const { return false; }
+};
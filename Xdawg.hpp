@@ -0,0 +1,546 @@
+/**
+ * @file Xdawg.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief A word list compressed into a minimal acyclic automaton (DAWG):
+ *        words that share a prefix share its path from the start, and words
+ *        that share a suffix share its path to the end. The automaton is a
+ *        flat array of 32-bit edges that can be saved to a file and mapped
+ *        back, so many processes can share one copy of a dictionary through
+ *        the page cache.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint32_t, uint64_t
+#include <cstdio>      // for FILE, fopen, fwrite, rename
+#include <cstring>     // for memcpy, memcmp
+#include <optional>    // for optional
+#include <stdexcept>   // for basic exceptions
+#include <string>      // for string
+#include <string_view> // for string_view
+#include "Xvector.hpp"
+#include "XmappedFile.hpp"
+#include "XhashIndex.hpp"
+#include "XstringVector.hpp"
+#include "Xsnapshot.hpp" // for xsnapshot_checksum
+using namespace std;
+
+const uint32_t xdawg_version = 2; // Bump when the file layout changes
+
+/**
+ * @brief Layout of the start of a DAWG file. The edges follow it, one
+ *        32-bit word each, in the byte order of the machine that wrote them.
+ *
+ */
+struct xdawg_header
+{
+    char magic[8];       // "XDAWGFSA"
+    uint32_t version;    // xdawg_version
+    uint32_t flags;      // Bit 0: the empty word is in the list
+    uint64_t edge_count; // Number of edges, including the unused edge 0
+    uint64_t word_count; // Number of distinct words
+    uint64_t root;       // Index of the first edge of the start state
+    uint64_t checksum;   // xdawg_checksum of the header and edges
+    uint64_t max_length; // Length of the longest word
+    uint64_t unused;     // Pads the header to 64 bytes
+};
+static_assert(sizeof(xdawg_header) == 64, "xdawg_header must stay 64 bytes");
+
+/**
+ * @brief Hashes a DAWG header, with its checksum field taken as 0, and then
+ *        its edges, so a damaged max_length or root fails verification just
+ *        like a damaged edge.
+ *
+ * @param head Header of the DAWG.
+ * @param edges Pointer to the edges.
+ * @param bytes Number of bytes of edges.
+ * @return uint64_t
+ */
+inline uint64_t xdawg_checksum(xdawg_header head, const void *edges, size_t bytes)
+{
+    head.checksum = 0;
+    return xsnapshot_checksum(edges, bytes, xsnapshot_checksum(&head, sizeof(head)));
+}
+
+/**
+ * @brief A read-only set of strings stored as a minimal acyclic automaton.
+ *
+ *        A state is a run of edges sorted by label, the last one flagged.
+ *        Each edge is packed in 32 bits: the label in bits 0-7, bit 8 set if
+ *        a word ends after the edge, bit 9 set on a state's last edge, and in
+ *        bits 10-31 the index of the target state's first edge, 0 if the
+ *        target has no edges. States are laid out depth first, so a state's
+ *        children mostly follow it in memory. Up to 2^22 edges can be
+ *        addressed, several times what a 100k-word dictionary needs.
+ *
+ *        Build one from a sorted list with build(), or map one written by
+ *        save() with load().
+ */
+class Xdawg
+{
+private:
+    static constexpr uint32_t final_bit = 1u << 8; // A word ends after the edge
+    static constexpr uint32_t last_bit = 1u << 9;  // Last edge of its state
+    static constexpr int target_shift = 10;        // Target edge index in the top 22 bits
+
+    optional<XmappedFile> file;     // Mapping of a loaded DAWG, empty if built in memory
+    Xvector<uint32_t> owned;        // Edges of a DAWG built in memory
+    const uint32_t *edges{nullptr}; // Edges in use, owned or mapped
+    size_t edge_count{0};           // Number of edges
+    size_t word_count{0};           // Number of distinct words
+    size_t max_length{0};           // Length of the longest word
+    uint32_t root{0};               // First edge of the start state, 0 if there are no edges
+    bool accepts_empty{false};      // The empty word is in the list
+
+    /**
+     * @brief A state of the automaton while it is being built.
+     *
+     */
+    struct build_state
+    {
+        Xvector<uint64_t> out; // Edges as label << 32 | target state, sorted by label
+        bool final{false};     // A word ends in this state
+    };
+
+    /**
+     * @brief Returns the edge leaving a state with the given label.
+     *
+     * @param state First edge of the state, not 0.
+     * @param label Label to look for.
+     * @return uint32_t the edge, or 0 if there is none.
+     */
+    uint32_t step(uint32_t state, unsigned char label) const;
+
+    /**
+     * @brief Calls fn for every word reached from a state, in sorted order,
+     *        until limit words have been reported. Walks depth first with an
+     *        explicit stack, writing each label once into a shared buffer.
+     *
+     * @tparam Fn type of callable taking a string_view.
+     * @param state First edge of the state.
+     * @param word Buffer of max_length characters starting with the path to
+     *        the state.
+     * @param depth Length of the path to the state.
+     * @param stack Buffer of max_length edge indices.
+     * @param fn Callable to be applied.
+     * @param limit Maximum number of words to report, at least 1.
+     * @return size_t number of words reported.
+     */
+    template <typename Fn>
+    size_t enumerate(uint32_t state, char *word, size_t depth, uint32_t *stack, Fn &fn, size_t limit) const;
+
+public:
+    /**
+     * @brief Construct a new empty Xdawg.
+     *
+     */
+    Xdawg() = default;
+
+    Xdawg(const Xdawg &) = delete;
+    Xdawg &operator=(const Xdawg &) = delete;
+
+    /**
+     * @brief Replaces the automaton with one of the given strings. Builds the
+     *        minimal automaton in one pass, registering each state once its
+     *        last word has gone by, so it needs memory for the automaton and
+     *        one word, not a trie of the whole list. Repeated strings are
+     *        stored once. Throws std::invalid_argument if the strings are
+     *        not sorted in byte order, and std::length_error if the automaton
+     *        needs more than 2^22 edges.
+     *
+     * @tparam InputIt type of iterator, its elements convert to string_view.
+     * @param first Iterator to the first string.
+     * @param last Iterator one past the last string.
+     */
+    template <typename InputIt>
+    void build(InputIt first, InputIt last);
+
+    /**
+     * @brief Maps a DAWG written by save(). Returns false, leaving the
+     *        object empty, if the file is missing, is not a DAWG of this
+     *        version, or (when verifying) fails its checksum.
+     *
+     * @param path Path of the file.
+     * @param verify If true, the checksum is recomputed, which reads the
+     *        whole file; if false, only the pages a lookup touches are read.
+     * @return true if loaded, false otherwise.
+     */
+    bool load(const char *path, bool verify = true);
+
+    /**
+     * @brief Writes the automaton to a file that load() maps back. Written
+     *        to a temporary file that is renamed over the path, like
+     *        xsnapshot_save. Throws std::runtime_error on failure.
+     *
+     * @param path Path of the file.
+     */
+    void save(const char *path) const;
+
+    /**
+     * @brief Tests if a string is in the set.
+     *
+     * @param word String to look for.
+     * @return true if found, false otherwise.
+     */
+    bool contains(string_view word) const;
+
+    /**
+     * @brief Calls fn(string_view) for every word that starts with prefix,
+     *        in sorted order, stopping after limit words, e.g. the first
+     *        suggestions for an autocomplete box. The view passed to fn is
+     *        only valid during the call.
+     *
+     * @tparam Fn type of callable taking a string_view.
+     * @param prefix Prefix to look for; empty for every word.
+     * @param fn Callable to be applied.
+     * @param limit Maximum number of words to report.
+     * @return size_t number of words reported.
+     */
+    template <typename Fn>
+    size_t for_each_prefixed(string_view prefix, Fn fn, size_t limit = SIZE_MAX) const;
+
+    /**
+     * @brief Returns the number of distinct words.
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Tests if the set is empty.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of edges, including the unused edge 0.
+     *
+     * @return size_t
+     */
+    size_t edges_size() const;
+
+    /**
+     * @brief Returns the bytes taken by the edges, which is all a lookup
+     *        reads.
+     *
+     * @return size_t
+     */
+    size_t memory_bytes() const;
+};
+
+inline uint32_t Xdawg::step(uint32_t state, unsigned char label) const
+{
+    for (uint32_t i = state;; i++)
+    {
+        uint32_t e = edges[i];
+        unsigned char l = static_cast<unsigned char>(e);
+        if (l == label)
+            return e;
+        if (l > label || (e & last_bit)) // Labels are sorted: the label is not here
+            return 0;
+    }
+}
+
+template <typename Fn>
+size_t Xdawg::enumerate(uint32_t state, char *word, size_t depth, uint32_t *stack, Fn &fn, size_t limit) const
+{
+    size_t reported = 0;
+    size_t base = depth;
+    uint32_t i = state;
+    for (;;)
+    {
+        uint32_t e = edges[i];
+        word[depth] = static_cast<char>(e & 0xFF);
+        if (e & final_bit)
+        {
+            fn(string_view(word, depth + 1));
+            if (++reported == limit)
+                return reported;
+        }
+        if (uint32_t target = e >> target_shift) // Descend into the target
+        {
+            stack[depth++] = i;
+            i = target;
+            continue;
+        }
+        while (edges[i] & last_bit) // Climb out of states whose edges are done
+        {
+            if (depth == base)
+                return reported;
+            i = stack[--depth];
+        }
+        i++;
+    }
+}
+
+template <typename InputIt>
+void Xdawg::build(InputIt first, InputIt last)
+{
+    Xvector<build_state> states;   // State 0 is the start state
+    Xvector<uint32_t> free_states; // States merged away, to be reused
+    XstringVector<> signatures;    // Final flag and edges of each registered state
+    Xvector<uint32_t> registered;  // State holding each signature
+    XhashIndex<XstringVector<>> register_index(signatures);
+    Xvector<uint32_t> path;        // States along the previous word, path[0] the start
+    states.emplace_back();
+    path.push_back(0);
+    string prev;
+    string sig;
+    size_t words = 0;
+    size_t longest = 0;
+    bool has_empty = false;
+
+    auto new_state = [&]() -> uint32_t
+    {
+        if (!free_states.empty())
+        {
+            uint32_t s = free_states[free_states.size() - 1];
+            free_states.pop_back();
+            states[s].out.resize(0); // Keeps the block, unlike clear
+            states[s].final = false;
+            return s;
+        }
+        states.emplace_back();
+        return static_cast<uint32_t>(states.size() - 1);
+    };
+    // Registers the states of the previous word past depth, deepest first,
+    // merging each with an equal registered state if there is one
+    auto minimize = [&](size_t depth)
+    {
+        for (size_t i = path.size() - 1; i > depth; i--)
+        {
+            uint32_t child = path[i];
+            sig.assign(1, states[child].final ? '1' : '0');
+            for (uint64_t out : states[child].out)
+                sig.append(reinterpret_cast<const char *>(&out), sizeof(out));
+            size_t pos = register_index.find(sig);
+            Xvector<uint64_t> &siblings = states[path[i - 1]].out;
+            uint64_t &link = siblings[siblings.size() - 1]; // The child is always its parent's newest edge
+            if (pos != register_index.npos)
+            {
+                link = (link & ~uint64_t(UINT32_MAX)) | registered[pos];
+                free_states.push_back(child);
+            }
+            else
+            {
+                signatures.push_back(sig);
+                registered.push_back(child);
+                register_index.insert(signatures.size() - 1);
+            }
+        }
+        path.resize(depth + 1);
+    };
+
+    for (; first != last; ++first)
+    {
+        string_view word = *first;
+        if (words && word <= prev)
+        {
+            if (word == prev)
+                continue;
+            throw invalid_argument("Xdawg::build: words are not sorted");
+        }
+        size_t common = 0;
+        while (common < word.size() && common < prev.size() && word[common] == prev[common])
+            common++;
+        minimize(common);
+        for (size_t i = common; i < word.size(); i++)
+        {
+            uint32_t s = new_state();
+            states[path[path.size() - 1]].out.push_back(uint64_t(static_cast<unsigned char>(word[i])) << 32 | s);
+            path.push_back(s);
+        }
+        states[path[path.size() - 1]].final = true;
+        has_empty = has_empty || word.empty();
+        longest = word.size() > longest ? word.size() : longest;
+        prev.assign(word.data(), word.size());
+        words++;
+    }
+    minimize(0);
+
+    // Lay the states out depth first; a state's edges get a block of their own
+    Xvector<uint32_t> block;
+    block.assign(states.size(), 0);
+    size_t total = 1 + states[0].out.size(); // Every registered state is reachable
+    for (uint32_t s : registered)
+        total += states[s].out.size();
+    Xvector<uint32_t> flat;
+    flat.reserve(total);
+    flat.push_back(0); // Edge 0 is unused, so 0 can mean "no edges"
+    auto place = [&](auto &self, uint32_t s) -> uint32_t
+    {
+        const Xvector<uint64_t> &out = states[s].out;
+        if (out.empty() || block[s])
+            return block[s];
+        uint32_t start = static_cast<uint32_t>(flat.size());
+        if (flat.size() + out.size() > (size_t(1) << (32 - target_shift)))
+            throw length_error("Xdawg::build: too many edges");
+        block[s] = start;
+        flat.resize(flat.size() + out.size());
+        for (size_t i = 0; i < out.size(); i++)
+        {
+            uint32_t child = static_cast<uint32_t>(out[i]);
+            uint32_t e = static_cast<uint32_t>(out[i] >> 32);
+            if (states[child].final)
+                e |= final_bit;
+            if (i + 1 == out.size())
+                e |= last_bit;
+            e |= self(self, child) << target_shift;
+            flat[start + i] = e;
+        }
+        return start;
+    };
+    uint32_t start = place(place, 0);
+
+    file.reset();
+    owned = move(flat);
+    edges = owned.begin();
+    edge_count = owned.size();
+    word_count = words;
+    max_length = longest;
+    root = start;
+    accepts_empty = has_empty;
+}
+
+inline bool Xdawg::load(const char *path, bool verify)
+{
+    file.reset();
+    owned.clear();
+    edges = nullptr;
+    edge_count = word_count = max_length = root = 0;
+    accepts_empty = false;
+    try
+    {
+        file.emplace(path, false); // Lazy mapping: pages are read only when used
+    }
+    catch (const runtime_error &)
+    {
+        return false;
+    }
+
+    xdawg_header head;
+    bool ok = file->size() >= sizeof(head);
+    if (ok)
+    {
+        memcpy(&head, file->data(), sizeof(head));
+        ok = memcmp(head.magic, "XDAWGFSA", 8) == 0 && head.version == xdawg_version && head.edge_count >= 1 &&
+             head.edge_count <= (size_t(1) << (32 - target_shift)) &&
+             sizeof(head) + head.edge_count * sizeof(uint32_t) == file->size() && head.root < head.edge_count &&
+             head.max_length < head.edge_count + 1; // A path visits each state at most once
+    }
+    if (ok && verify)
+        ok = xdawg_checksum(head, file->data() + sizeof(head), file->size() - sizeof(head)) == head.checksum;
+    if (!ok)
+    {
+        file.reset();
+        return false;
+    }
+
+    edges = reinterpret_cast<const uint32_t *>(file->data() + sizeof(head)); // The mapping is page aligned
+    edge_count = head.edge_count;
+    word_count = head.word_count;
+    max_length = head.max_length;
+    root = static_cast<uint32_t>(head.root);
+    accepts_empty = head.flags & 1;
+    return true;
+}
+
+inline void Xdawg::save(const char *path) const
+{
+    xdawg_header head{};
+    memcpy(head.magic, "XDAWGFSA", 8);
+    head.version = xdawg_version;
+    head.flags = accepts_empty ? 1 : 0;
+    uint32_t unused_edge = 0;
+    const uint32_t *body = edge_count ? edges : &unused_edge; // An empty Xdawg still has edge 0 on disk
+    head.edge_count = edge_count ? edge_count : 1;
+    head.word_count = word_count;
+    head.root = root;
+    head.max_length = max_length;
+    head.checksum = xdawg_checksum(head, body, head.edge_count * sizeof(uint32_t));
+
+    string tmp = string(path) + ".tmp";
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (!f)
+        throw runtime_error("Xdawg::save: cannot open " + tmp);
+    bool ok = fwrite(&head, sizeof(head), 1, f) == 1 &&
+              fwrite(body, sizeof(uint32_t), head.edge_count, f) == head.edge_count;
+    ok = fclose(f) == 0 && ok;
+    if (!ok || rename(tmp.c_str(), path) != 0)
+    {
+        remove(tmp.c_str());
+        throw runtime_error(string("Xdawg::save: cannot write ") + path);
+    }
+}
+
+inline bool Xdawg::contains(string_view word) const
+{
+    if (word.empty())
+        return accepts_empty;
+    uint32_t state = root;
+    uint32_t e = 0;
+    for (char c : word)
+    {
+        if (!state)
+            return false;
+        e = step(state, static_cast<unsigned char>(c));
+        if (!e)
+            return false;
+        state = e >> target_shift;
+    }
+    return e & final_bit;
+}
+
+template <typename Fn>
+size_t Xdawg::for_each_prefixed(string_view prefix, Fn fn, size_t limit) const
+{
+    uint32_t state = root;
+    bool final = accepts_empty;
+    for (char c : prefix)
+    {
+        uint32_t e = state ? step(state, static_cast<unsigned char>(c)) : 0;
+        if (!e)
+            return 0;
+        final = e & final_bit;
+        state = e >> target_shift;
+    }
+    size_t reported = 0;
+    if (final && limit)
+    {
+        fn(prefix);
+        reported++;
+    }
+    if (!state || reported == limit)
+        return reported;
+
+    char small_word[64]; // Enough for the words of most languages, without allocating
+    uint32_t small_stack[64];
+    Xvector<char> big_word;
+    Xvector<uint32_t> big_stack;
+    char *word = small_word;
+    uint32_t *stack = small_stack;
+    if (max_length > 64)
+    {
+        big_word.resize_for_overwrite(max_length);
+        big_stack.resize_for_overwrite(max_length);
+        word = big_word.begin();
+        stack = big_stack.begin();
+    }
+    memcpy(word, prefix.data(), prefix.size()); // The state is reachable, so the prefix is shorter than max_length
+    return reported + enumerate(state, word, prefix.size(), stack, fn, limit - reported);
+}
+
+inline size_t Xdawg::size() const { return word_count; }
+
+inline bool Xdawg::empty() const { return !word_count; }
+
+inline size_t Xdawg::edges_size() const { return edge_count; }
+
+inline size_t Xdawg::memory_bytes() const { return edge_count * sizeof(uint32_t); }
@@ -0,0 +1,380 @@
+/**
+ * @file XhashIndex.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief A flat open-addressing hash index over a container of strings, for
+ *        constant-time membership tests on a loaded word list. The index
+ *        holds positions into the container, never copies of the strings.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for int8_t, uint32_t, uint64_t
+#include <cstring>     // for memcpy
+#include <stdexcept>   // for basic exceptions
+#include <string_view> // for string_view
+#include "Xvector.hpp"
+#ifdef __SSE2__
+#include <emmintrin.h> // for SSE2 intrinsics
+#endif
+using namespace std;
+
+/**
+ * @brief Fast hash of a string for XhashIndex. Short strings, the bulk of a
+ *        dictionary, are read in at most two overlapping loads; the result
+ *        is mixed so both its low bits and its top bits are usable. Not
+ *        resistant to inputs crafted to collide.
+ *
+ */
+struct xhash_string
+{
+    uint64_t operator()(string_view s) const
+    {
+        const char *p = s.data();
+        size_t n = s.size();
+        const uint64_t k1 = 0x9E3779B185EBCA87ULL;
+        const uint64_t k2 = 0xC2B2AE3D27D4EB4FULL;
+        uint64_t h = n * k1;
+        if (n >= 8)
+        {
+            uint64_t w;
+            for (size_t i = 0; i + 8 < n; i += 8)
+            {
+                memcpy(&w, p + i, 8);
+                h = (h ^ w) * k2;
+                h ^= h >> 29;
+            }
+            memcpy(&w, p + n - 8, 8); // Last 8 bytes, overlapping the loop's
+            h = (h ^ w) * k2;
+        }
+        else if (n >= 4)
+        {
+            uint32_t lo, hi;
+            memcpy(&lo, p, 4);
+            memcpy(&hi, p + n - 4, 4);
+            h = (h ^ (uint64_t(lo) << 32 | hi)) * k2;
+        }
+        else if (n > 0)
+        {
+            uint64_t w = uint64_t(uint8_t(p[0])) << 16 | uint64_t(uint8_t(p[n / 2])) << 8 | uint8_t(p[n - 1]);
+            h = (h ^ w) * k2;
+        }
+        h ^= h >> 32;
+        h *= k1;
+        h ^= h >> 29;
+        return h;
+    }
+};
+
+/**
+ * @brief A hash set of the strings in a container, stored as their positions
+ *        in it. Built SwissTable style: each slot has a control byte holding
+ *        7 bits of the key's hash, or a marker for an empty slot, and a probe
+ *        compares 16 control bytes at once with SSE2, so a lookup usually
+ *        touches one line of control bytes, one slot and the string itself.
+ *        The table is kept at most 7/8 full.
+ *
+ *        The index reads the container on every lookup, so the container
+ *        must outlive it, and its indexed elements must not be changed or
+ *        moved to other positions. Appending is fine as long as new elements
+ *        are added with insert. Duplicate strings keep their first position.
+ *
+ * @tparam Container type of container, e.g. Xvector<string>; operator[]
+ *         must return something that converts to string_view.
+ * @tparam Hash type of hash function, default is xhash_string.
+ */
+template <typename Container, typename Hash = xhash_string>
+class XhashIndex
+{
+private:
+    static constexpr size_t group_width = 16; // Control bytes compared per probe step
+    static constexpr int8_t empty_slot = -128; // Control byte of an empty slot; used ones hold 0..127
+
+    /**
+     * @brief The control bytes of one probe step, with bit masks of the
+     *        bytes that match a value.
+     *
+     */
+    struct group
+    {
+#ifdef __SSE2__
+        __m128i bytes;
+
+        explicit group(const int8_t *p) : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))) {}
+
+        uint32_t match(int8_t x) const { return _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(x))); }
+#else
+        const int8_t *bytes;
+
+        explicit group(const int8_t *p) : bytes(p) {}
+
+        uint32_t match(int8_t x) const
+        {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < group_width; i++)
+                mask |= uint32_t(bytes[i] == x) << i;
+            return mask;
+        }
+#endif
+    };
+
+    const Container *words{nullptr}; // Strings being indexed
+    Xvector<int8_t> ctrl;            // One control byte per slot, then copies of the first group_width - 1
+    Xvector<uint32_t> slots;         // Position in words of each used slot
+    size_t slot_mask{0};             // Number of slots - 1, a power of two minus 1
+    size_t count{0};                 // Number of used slots
+    Hash hasher;
+
+    /**
+     * @brief Sets the control byte of a slot, and its copy past the end
+     *        that lets a probe near the end read a whole group.
+     *
+     * @param slot Index of the slot.
+     * @param x New control byte.
+     */
+    void set_ctrl(size_t slot, int8_t x);
+
+    /**
+     * @brief Finds the slot holding a key, or the empty slot where it would
+     *        go.
+     *
+     * @param key String to look for.
+     * @param h Hash of the key.
+     * @param found Set to whether the key is in the table.
+     * @return size_t index of the slot.
+     */
+    size_t probe(string_view key, uint64_t h, bool &found) const;
+
+    /**
+     * @brief Replaces the table with an empty one of the given number of
+     *        slots and inserts every indexed position again.
+     *
+     * @param new_slots Number of slots, a power of two of at least 16.
+     */
+    void rehash(size_t new_slots);
+
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /**
+     * @brief Construct a new empty XhashIndex, not attached to a container.
+     *
+     */
+    XhashIndex() = default;
+
+    /**
+     * @brief Construct a new XhashIndex of every string in a container.
+     *
+     * @param container Container to index.
+     */
+    explicit XhashIndex(const Container &container);
+
+    /**
+     * @brief Replaces the index with one of every string in a container,
+     *        sized up front so building does not rehash.
+     *
+     * @param container Container to index.
+     */
+    void build(const Container &container);
+
+    /**
+     * @brief Adds the string at the given position of the container, e.g.
+     *        after a push_back. Throws std::length_error if the position does
+     *        not fit in 32 bits.
+     *
+     * @param pos Position in the container.
+     * @return true if added, false if an equal string was already indexed.
+     */
+    bool insert(size_t pos);
+
+    /**
+     * @brief Returns the position of a string in the container.
+     *
+     * @param key String to look for.
+     * @return size_t position, or npos if not indexed.
+     */
+    size_t find(string_view key) const;
+
+    /**
+     * @brief Tests if a string is indexed.
+     *
+     * @param key String to look for.
+     * @return true if indexed, false otherwise.
+     */
+    bool contains(string_view key) const;
+
+    /**
+     * @brief Returns the number of distinct strings indexed.
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Tests if the index is empty.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of slots in the table.
+     *
+     * @return size_t
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Returns the bytes used by the table, excluding the strings.
+     *
+     * @return size_t
+     */
+    size_t memory_bytes() const;
+};
+
+template <typename Container, typename Hash>
+inline void XhashIndex<Container, Hash>::set_ctrl(size_t slot, int8_t x)
+{
+    ctrl[slot] = x;
+    if (slot < group_width - 1)
+        ctrl[slot_mask + 1 + slot] = x;
+}
+
+template <typename Container, typename Hash>
+inline size_t XhashIndex<Container, Hash>::probe(string_view key, uint64_t h, bool &found) const
+{
+    int8_t tag = static_cast<int8_t>(h >> 57); // Top 7 bits; the low bits pick the start
+    size_t pos = h & slot_mask;
+    for (size_t step = group_width;; step += group_width) // Triangular steps visit every group
+    {
+        group g(ctrl.begin() + pos);
+        for (uint32_t m = g.match(tag); m; m &= m - 1)
+        {
+            size_t slot = (pos + xvector_low_bit(m)) & slot_mask;
+            if (string_view((*words)[slots[slot]]) == key)
+            {
+                found = true;
+                return slot;
+            }
+        }
+        if (uint32_t m = g.match(empty_slot)) // An empty slot ends the chain: the key is absent
+        {
+            found = false;
+            return (pos + xvector_low_bit(m)) & slot_mask;
+        }
+        pos = (pos + step) & slot_mask;
+    }
+}
+
+template <typename Container, typename Hash>
+void XhashIndex<Container, Hash>::rehash(size_t new_slots)
+{
+    Xvector<uint32_t> old;
+    old.reserve(count);
+    for (size_t i = 0; i <= slot_mask && count; i++) // Keep positions in the order they occupy slots
+        if (ctrl[i] != empty_slot)
+            old.push_back(slots[i]);
+
+    ctrl.assign(new_slots + group_width - 1, empty_slot);
+    slots.resize_for_overwrite(new_slots);
+    slot_mask = new_slots - 1;
+    count = 0;
+    for (uint32_t pos : old)
+    {
+        string_view key((*words)[pos]);
+        uint64_t h = hasher(key);
+        bool found;
+        size_t slot = probe(key, h, found);
+        set_ctrl(slot, static_cast<int8_t>(h >> 57));
+        slots[slot] = pos;
+        count++;
+    }
+}
+
+template <typename Container, typename Hash>
+XhashIndex<Container, Hash>::XhashIndex(const Container &container)
+{
+    build(container);
+}
+
+template <typename Container, typename Hash>
+void XhashIndex<Container, Hash>::build(const Container &container)
+{
+    words = &container;
+    size_t n = container.size();
+    size_t new_slots = group_width;
+    while (new_slots / 8 * 7 < n)
+        new_slots *= 2;
+    count = 0;
+    slot_mask = 0;
+    rehash(new_slots);
+    for (size_t pos = 0; pos < n; pos++)
+        insert(pos);
+}
+
+template <typename Container, typename Hash>
+bool XhashIndex<Container, Hash>::insert(size_t pos)
+{
+    if (pos > UINT32_MAX)
+        throw length_error("XhashIndex::insert: position does not fit in 32 bits");
+    if (ctrl.empty())
+        rehash(group_width);
+    else if (count + 1 > (slot_mask + 1) / 8 * 7)
+        rehash((slot_mask + 1) * 2);
+
+    string_view key((*words)[pos]);
+    uint64_t h = hasher(key);
+    bool found;
+    size_t slot = probe(key, h, found);
+    if (found)
+        return false;
+    set_ctrl(slot, static_cast<int8_t>(h >> 57));
+    slots[slot] = static_cast<uint32_t>(pos);
+    count++;
+    return true;
+}
+
+template <typename Container, typename Hash>
+inline size_t XhashIndex<Container, Hash>::find(string_view key) const
+{
+    if (!count)
+        return npos;
+    bool found;
+    size_t slot = probe(key, hasher(key), found);
+    return found ? slots[slot] : npos;
+}
+
+template <typename Container, typename Hash>
+inline bool XhashIndex<Container, Hash>::contains(string_view key) const
+{
+    return find(key) != npos;
+}
+
+template <typename Container, typename Hash>
+inline size_t XhashIndex<Container, Hash>::size() const
+{
+    return count;
+}
+
+template <typename Container, typename Hash>
+inline bool XhashIndex<Container, Hash>::empty() const
+{
+    return !count;
+}
+
+template <typename Container, typename Hash>
+inline size_t XhashIndex<Container, Hash>::capacity() const
+{
+    return ctrl.empty() ? 0 : slot_mask + 1;
+}
+
+template <typename Container, typename Hash>
+inline size_t XhashIndex<Container, Hash>::memory_bytes() const
+{
+    return ctrl.capacity() * sizeof(int8_t) + slots.capacity() * sizeof(uint32_t);
+}
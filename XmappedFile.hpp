@@ -0,0 +1,313 @@
+/**
+ * @file XmappedFile.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Read-only memory-mapped file and a zero-copy line splitter that fills
+ *        an Xvector of string_views pointing into the mapping.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>      // for size_t
+#include <cstdio>       // for FILE, fopen, fread
+#include <cstring>      // for memchr
+#include <exception>    // for exception_ptr, rethrow_exception
+#include <stdexcept>    // for basic exceptions
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <system_error> // for system_error
+#include <thread>       // for thread
+#include <vector>       // for vector of workers
+#include "Xvector.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h> // for SSE2 intrinsics
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define XMAPPEDFILE_USE_MMAP 1
+#include <fcntl.h>    // for open
+#include <sys/mman.h> // for mmap, munmap, madvise
+#include <sys/stat.h> // for fstat
+#include <unistd.h>   // for close
+#endif
+using namespace std;
+
+/**
+ * @brief A whole file mapped read-only into memory. Where mmap is not
+ *        available the file is read into a buffer instead, so callers see
+ *        the same interface either way. Throws std::runtime_error if the file
+ *        cannot be opened or mapped.
+ *
+ */
+class XmappedFile
+{
+private:
+    const char *file_data{nullptr}; // First byte of the file
+    size_t file_size{0};            // Number of bytes in the file
+#ifndef XMAPPEDFILE_USE_MMAP
+    Xvector<char> buffer; // Holds the file when it cannot be mapped
+#endif
+
+public:
+    /**
+     * @brief Maps the file at the given path.
+     *
+     * @param path Path of the file.
+     * @param populate If true, every page is read in up front for a fast
+     *        sequential scan; if false, pages are read when first touched, so
+     *        opening costs the same for any file size.
+     */
+    explicit XmappedFile(const char *path, bool populate = true);
+
+    /**
+     * @brief Unmaps the file. Views into it become dangling.
+     *
+     */
+    ~XmappedFile();
+
+    XmappedFile(const XmappedFile &) = delete;
+    XmappedFile &operator=(const XmappedFile &) = delete;
+
+    /**
+     * @brief Returns a pointer to the first byte of the file.
+     *
+     * @return const char*
+     */
+    const char *data() const;
+
+    /**
+     * @brief Returns the size of the file in bytes.
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the whole file as a string_view.
+     *
+     * @return string_view
+     */
+    string_view view() const;
+};
+
+#ifdef XMAPPEDFILE_USE_MMAP
+
+inline XmappedFile::XmappedFile(const char *path, bool populate)
+{
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+        throw runtime_error(string("XmappedFile: cannot open ") + path);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        throw runtime_error(string("XmappedFile: cannot stat ") + path);
+    }
+
+    file_size = static_cast<size_t>(st.st_size);
+    if (file_size) // mmap rejects empty mappings
+    {
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        if (populate)
+            flags |= MAP_POPULATE; // Fault the pages in up front, in bulk
+#endif
+        void *p = mmap(nullptr, file_size, PROT_READ, flags, fd, 0);
+        if (p == MAP_FAILED)
+        {
+            ::close(fd);
+            throw runtime_error(string("XmappedFile: cannot map ") + path);
+        }
+        if (populate)
+            madvise(p, file_size, MADV_SEQUENTIAL); // Read-ahead aggressively
+        file_data = static_cast<const char *>(p);
+    }
+    ::close(fd); // The mapping keeps the file alive
+}
+
+inline XmappedFile::~XmappedFile()
+{
+    if (file_data)
+        munmap(const_cast<char *>(file_data), file_size);
+}
+
+#else
+
+inline XmappedFile::XmappedFile(const char *path, bool)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        throw runtime_error(string("XmappedFile: cannot open ") + path);
+
+    size_t used = 0;
+    for (;;) // Read straight into the buffer, growing it without zero-filling
+    {
+        if (used == buffer.size())
+            buffer.resize_for_overwrite(used ? used * 2 : 1 << 16);
+        size_t n = fread(buffer.begin() + used, 1, buffer.size() - used, f);
+        if (!n)
+            break;
+        used += n;
+    }
+    fclose(f);
+    buffer.resize(used);
+    file_data = buffer.begin();
+    file_size = buffer.size();
+}
+
+inline XmappedFile::~XmappedFile() {}
+
+#endif
+
+inline const char *XmappedFile::data() const { return file_data; }
+
+inline size_t XmappedFile::size() const { return file_size; }
+
+inline string_view XmappedFile::view() const { return string_view(file_data, file_size); }
+
+/**
+ * @brief Appends every non-empty line of a text to an Xvector of string_views
+ *        that point into the text, without copying or allocating per line. A
+ *        trailing '\r' is dropped from each line. With SSE2 the text is
+ *        scanned 16 bytes at a time and each newline is taken from a bit mask,
+ *        so short lines cost a few instructions each; the tail, and targets
+ *        without SSE2, fall back to memchr.
+ *
+ * @tparam Alloc type of allocator.
+ * @tparam Growth growth policy.
+ * @tparam InlineCap number of inline elements.
+ * @tparam Track instrumentation policy.
+ * @param text Text to split, e.g. XmappedFile::view().
+ * @param lines Vector the lines are appended to.
+ * @return size_t number of lines appended.
+ */
+template <typename Alloc, typename Growth, size_t InlineCap, typename Track>
+size_t split_lines(string_view text, Xvector<string_view, Alloc, Growth, InlineCap, Track> &lines)
+{
+    size_t before = lines.size();
+    const char *p = text.data(); // Start of the current line
+    const char *stop = p + text.size();
+    auto emit = [&](const char *line_end)
+    {
+        const char *word_end = line_end;
+        if (word_end > p && word_end[-1] == '\r')
+            word_end--;
+        if (word_end > p)
+            lines.emplace_back(p, static_cast<size_t>(word_end - p));
+        p = line_end + 1;
+    };
+
+    const char *scan = p; // Start of the next block to scan
+#if defined(__SSE2__)
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; stop - scan >= 16; scan += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(scan));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+        while (mask)
+        {
+            emit(scan + xvector_low_bit(mask));
+            mask &= mask - 1; // Clear the lowest set bit
+        }
+    }
+#endif
+
+    while (scan < stop)
+    {
+        const char *nl = static_cast<const char *>(memchr(scan, '\n', stop - scan));
+        if (!nl)
+            break;
+        emit(nl);
+        scan = nl + 1;
+    }
+    if (p < stop) // Last line without a trailing newline
+        emit(stop);
+    return lines.size() - before;
+}
+
+/**
+ * @brief Splits a text into lines on several threads. The text is cut into
+ *        one byte range per thread, each cut moved forward to just past a
+ *        newline, so every line falls in exactly one range. Each thread fills
+ *        its own scratch Xvector, and the parts are then appended in order
+ *        after a single reserve on the calling thread, so the result is
+ *        identical to split_lines and lines may use any allocator. An
+ *        exception in a worker is rethrown after every thread is joined, and
+ *        if threads cannot be started the text is split on this thread.
+ *
+ * @tparam Alloc type of allocator.
+ * @tparam Growth growth policy.
+ * @tparam InlineCap number of inline elements.
+ * @tparam Track instrumentation policy.
+ * @param text Text to split, e.g. XmappedFile::view().
+ * @param lines Vector the lines are appended to.
+ * @param threads Number of threads, 0 for one per hardware thread.
+ * @return size_t number of lines appended.
+ */
+template <typename Alloc, typename Growth, size_t InlineCap, typename Track>
+size_t split_lines_parallel(string_view text, Xvector<string_view, Alloc, Growth, InlineCap, Track> &lines, size_t threads = 0)
+{
+    if (!threads)
+        threads = thread::hardware_concurrency();
+    if (threads <= 1 || text.size() < threads * 4096) // Not worth the threads
+        return split_lines(text, lines);
+
+    Xvector<size_t> cuts; // Range i is [cuts[i], cuts[i + 1])
+    cuts.push_back(0);
+    for (size_t i = 1; i < threads; i++)
+    {
+        size_t cut = text.size() * i / threads;
+        if (cut < cuts[cuts.size() - 1])
+            cut = cuts[cuts.size() - 1];
+        const char *nl = static_cast<const char *>(memchr(text.data() + cut, '\n', text.size() - cut));
+        cuts.push_back(nl ? static_cast<size_t>(nl - text.data()) + 1 : text.size());
+    }
+    cuts.push_back(text.size());
+
+    // Scratch parts use the default allocator: an arena shared with lines is
+    // not thread-safe, and a thread_local arena dies with its worker
+    vector<Xvector<string_view>> parts(threads);
+    vector<exception_ptr> errors(threads); // Rethrown once every worker is joined
+    vector<thread> workers;
+    workers.reserve(threads);
+    try
+    {
+        for (size_t i = 0; i < threads; i++)
+            workers.emplace_back([&, i]
+            {
+                try
+                {
+                    split_lines(text.substr(cuts[i], cuts[i + 1] - cuts[i]), parts[i]);
+                }
+                catch (...)
+                {
+                    errors[i] = current_exception();
+                }
+            });
+    }
+    catch (const system_error &) // No more threads: split on this one instead
+    {
+        for (thread &w : workers)
+            w.join();
+        return split_lines(text, lines);
+    }
+    for (thread &w : workers)
+        w.join();
+    for (exception_ptr &e : errors)
+        if (e)
+            rethrow_exception(e);
+
+    size_t total = 0;
+    for (auto &part : parts)
+        total += part.size();
+    lines.reserve(lines.size() + total);
+    for (auto &part : parts)
+        lines.append(part.begin(), part.size()); // One memcpy per part
+    return total;
+}
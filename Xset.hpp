@@ -0,0 +1,504 @@
+/**
+ * @file Xset.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Set operations on sorted Xvectors: unique, union, intersection and
+ *        difference, each in one pass over its inputs, writing into an
+ *        output reserved once, or into the first input in place. When one
+ *        input is much larger than the other, the larger one is searched
+ *        with galloping (exponential) searches instead of being stepped
+ *        through; intersections of 32-bit integer IDs compare four against
+ *        four with SSE2.
+ *
+ *        Inputs are sets: sorted by the comparison, with no two elements
+ *        equal (xset_unique makes one from a sorted vector). Elements taken
+ *        from either input are converted to the output's element type, so
+ *        e.g. an Xvector<string_view> can be merged into an Xvector<string>.
+ *        An output must not be one of the inputs; use the in-place versions
+ *        for that.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>   // for lower_bound, move, move_backward
+#include <cstddef>     // for size_t
+#include <cstdint>     // for int32_t, uint32_t
+#include <functional>  // for less
+#include <string_view> // for string_view
+#include <type_traits> // for is_convertible, is_same, remove_cv, remove_reference
+#include <utility>     // for declval, move
+#include "Xvector.hpp"
+#include "Xsimd.hpp"
+using namespace std;
+
+const size_t xset_gallop_ratio = 32; // Past this size ratio, the larger input is searched, not stepped through
+
+/**
+ * @brief Element type of a vector.
+ *
+ */
+template <typename Vector>
+using xset_element = typename remove_cv<typename remove_reference<decltype(*declval<Vector &>().begin())>::type>::type;
+
+/**
+ * @brief True when an intersection can take the SSE2 path: both inputs hold
+ *        the same 32-bit integer type, in ascending order.
+ *
+ */
+template <typename TA, typename TB, typename Compare>
+constexpr bool xset_simd_ids = is_same<TA, TB>::value &&
+                               (is_same<TA, int32_t>::value || is_same<TA, uint32_t>::value) &&
+                               (is_same<Compare, less<>>::value || is_same<Compare, less<TA>>::value);
+
+/**
+ * @brief Returns the first position in [first, last) whose element is not
+ *        less than value, found by checking positions 1, 2, 4, 8... ahead,
+ *        then bisecting the last step. Costs O(log d) for an answer d
+ *        positions ahead, so a walk of many such searches through a large
+ *        input costs O(m log(n / m)) in all.
+ *
+ */
+template <typename T, typename U, typename Compare>
+inline const T *xset_gallop(const T *first, const T *last, const U &value, Compare &comp)
+{
+    size_t n = last - first;
+    size_t lo = 0; // Every position before lo is less than value
+    size_t step = 1;
+    while (step <= n && comp(first[step - 1], value))
+    {
+        lo = step;
+        step *= 2;
+    }
+    return lower_bound(first + lo, first + (step <= n ? step - 1 : n), value, comp);
+}
+
+/**
+ * @brief Compares two elements in one call: negative, zero or positive as x
+ *        is before, equal to or after y. Strings in their natural order take
+ *        one three-way comparison instead of two calls to operator<.
+ *
+ */
+template <typename TA, typename TB, typename Compare>
+inline int xset_order(const TA &x, const TB &y, Compare &comp)
+{
+    if constexpr (is_same<Compare, less<>>::value && is_convertible<const TA &, string_view>::value &&
+                  is_convertible<const TB &, string_view>::value)
+        return string_view(x).compare(string_view(y));
+    else
+        return comp(x, y) ? -1 : comp(y, x) ? 1 : 0;
+}
+
+/**
+ * @brief Tests if two elements in sorted order, x not after y, are equal.
+ *        Strings in their natural order are tested with operator==, which
+ *        tells most unequal strings apart by their lengths alone.
+ *
+ */
+template <typename T, typename Compare>
+inline bool xset_equal_sorted(const T &x, const T &y, Compare &comp)
+{
+    if constexpr (is_same<Compare, less<>>::value && is_convertible<const T &, string_view>::value)
+        return string_view(x) == string_view(y);
+    else
+        return !comp(x, y);
+}
+
+#ifdef XSIMD_X86
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+/**
+ * @brief Intersects blocks of four 32-bit IDs: each block of a is compared
+ *        with each block of b it overlaps, against all four rotations of the
+ *        b block, and the input whose block ends lower moves on. A block of
+ *        a is taken once it is done with, so take never writes past what
+ *        has been read and a may be the output. Stops when either input has
+ *        less than a block left.
+ *
+ * @param i Position in a, advanced past the blocks done with.
+ * @param j Position in b, advanced past the blocks done with.
+ * @return unsigned Matches found so far in the block of a at i, one bit each.
+ */
+template <typename T, typename Take>
+XSIMD_SSE2 unsigned xset_intersect_sse2(const T *a, size_t na, const T *b, size_t nb, size_t &i, size_t &j, Take &take)
+{
+    unsigned pending = 0;
+    while (i + 4 <= na && j + 4 <= nb)
+    {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+        __m128i eq = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+            _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                         _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+        pending |= static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+        T a_last = a[i + 3];
+        T b_last = b[j + 3];
+        if (!(b_last < a_last))
+        {
+            for (size_t k = 0; k < 4; k++)
+                if (pending >> k & 1)
+                    take(a + i + k);
+            pending = 0;
+            i += 4;
+        }
+        if (!(a_last < b_last))
+            j += 4;
+    }
+    return pending;
+}
+
+#pragma GCC diagnostic pop
+#endif
+
+/**
+ * @brief Intersection of two sets, calling take with a pointer to each
+ *        element of a that is also in b, in order. Take may move the element
+ *        to a position of a at or before it: every element is read before
+ *        any write that could reach it.
+ *
+ */
+template <typename TA, typename TB, typename Compare, typename Take>
+void xset_intersection_walk(const TA *a, size_t na, const TB *b, size_t nb, Compare &comp, Take take)
+{
+    if (na > nb * xset_gallop_ratio) // Few elements of b, each searched for in a
+    {
+        const TA *pos = a;
+        for (size_t j = 0; j < nb && pos != a + na; j++)
+        {
+            pos = xset_gallop(pos, a + na, b[j], comp);
+            if (pos != a + na && !comp(b[j], *pos))
+                take(pos++);
+        }
+        return;
+    }
+    if (nb > na * xset_gallop_ratio) // Few elements of a, each searched for in b
+    {
+        const TB *pos = b;
+        for (size_t i = 0; i < na && pos != b + nb; i++)
+        {
+            pos = xset_gallop(pos, b + nb, a[i], comp);
+            if (pos != b + nb && !comp(a[i], *pos))
+            {
+                take(a + i);
+                pos++;
+            }
+        }
+        return;
+    }
+
+    size_t i = 0;
+    size_t j = 0;
+#ifdef XSIMD_X86
+    if constexpr (xset_simd_ids<TA, TB, Compare>)
+        if (xsimd_active() != xsimd_isa::scalar)
+        {
+            unsigned pending = xset_intersect_sse2(a, na, b, nb, i, j, take);
+            if (pending) // Finish the block the vector loop stopped inside, one element at a time
+                for (size_t end = i + 4; i < end; i++)
+                {
+                    if (pending >> (4 - (end - i)) & 1)
+                    {
+                        take(a + i);
+                        continue;
+                    }
+                    while (j < nb && b[j] < a[i])
+                        j++;
+                    if (j < nb && b[j] == a[i])
+                    {
+                        take(a + i);
+                        j++;
+                    }
+                }
+        }
+#endif
+    while (i < na && j < nb)
+    {
+        int order = xset_order(a[i], b[j], comp);
+        if (order < 0)
+            i++;
+        else if (order > 0)
+            j++;
+        else
+        {
+            take(a + i++);
+            j++;
+        }
+    }
+}
+
+/**
+ * @brief Difference of two sets, calling take with a pointer to each
+ *        element of a that is not in b, in order, with the same guarantee
+ *        on moves as xset_intersection_walk.
+ *
+ */
+template <typename TA, typename TB, typename Compare, typename Take>
+void xset_difference_walk(const TA *a, size_t na, const TB *b, size_t nb, Compare &comp, Take take)
+{
+    size_t i = 0;
+    if (na > nb * xset_gallop_ratio) // Few elements of b: find each in a, keep the runs between them
+    {
+        for (size_t j = 0; j < nb && i < na; j++)
+        {
+            size_t found = xset_gallop(a + i, a + na, b[j], comp) - a;
+            for (; i < found; i++)
+                take(a + i);
+            if (i < na && !comp(b[j], a[i]))
+                i++;
+        }
+    }
+    else if (nb > na * xset_gallop_ratio) // Few elements of a: look each up in b
+    {
+        const TB *pos = b;
+        for (; i < na && pos != b + nb; i++)
+        {
+            pos = xset_gallop(pos, b + nb, a[i], comp);
+            if (pos == b + nb || comp(a[i], *pos))
+                take(a + i);
+        }
+    }
+    else
+        for (size_t j = 0; i < na && j < nb;)
+        {
+            int order = xset_order(a[i], b[j], comp);
+            if (order < 0)
+                take(a + i++);
+            else if (order > 0)
+                j++;
+            else
+            {
+                i++;
+                j++;
+            }
+        }
+    for (; i < na; i++)
+        take(a + i);
+}
+
+/**
+ * @brief Removes all but the first of each run of equal elements from a
+ *        sorted vector, in place, keeping its capacity.
+ *
+ * @tparam Vector type of vector, e.g. Xvector<string>.
+ * @tparam Compare type of comparison the vector is sorted by.
+ * @param v Vector to deduplicate, sorted.
+ * @param comp Comparison the vector is sorted by.
+ * @return size_t number of elements removed.
+ */
+template <typename Vector, typename Compare = less<>>
+size_t xset_unique(Vector &v, Compare comp = Compare())
+{
+    size_t n = v.size();
+    if (n < 2)
+        return 0;
+    auto *p = v.begin();
+    size_t w = 1;
+    for (size_t i = 1; i < n; i++)
+        if (!xset_equal_sorted(p[w - 1], p[i], comp))
+        {
+            if (w != i)
+                p[w] = move(p[i]);
+            w++;
+        }
+    v.erase(v.begin() + w, v.end());
+    return n - w;
+}
+
+/**
+ * @brief Writes the union of two sets into out, taking a's element where
+ *        both have an equal one. When one set is much smaller, runs of the
+ *        larger between its elements are found by galloping and appended
+ *        whole.
+ *
+ * @param a Sorted set.
+ * @param b Sorted set.
+ * @param out Output, emptied and reserved once for both inputs.
+ * @param comp Comparison the sets are sorted by.
+ */
+template <typename VectorA, typename VectorB, typename VectorOut, typename Compare = less<>>
+void xset_union(const VectorA &a, const VectorB &b, VectorOut &out, Compare comp = Compare())
+{
+    const auto *pa = a.begin();
+    const auto *pb = b.begin();
+    size_t na = a.size();
+    size_t nb = b.size();
+    out.resize(0);
+    out.reserve(na + nb);
+    size_t i = 0;
+    size_t j = 0;
+    if (na > nb * xset_gallop_ratio)
+        for (; j < nb; j++)
+        {
+            size_t found = xset_gallop(pa + i, pa + na, pb[j], comp) - pa;
+            out.append_range(pa + i, pa + found);
+            i = found;
+            if (i < na && !comp(pb[j], pa[i]))
+                out.emplace_back(pa[i++]);
+            else
+                out.emplace_back(pb[j]);
+        }
+    else if (nb > na * xset_gallop_ratio)
+        for (; i < na; i++)
+        {
+            size_t found = xset_gallop(pb + j, pb + nb, pa[i], comp) - pb;
+            out.append_range(pb + j, pb + found);
+            j = found;
+            if (j < nb && !comp(pa[i], pb[j]))
+                j++;
+            out.emplace_back(pa[i]);
+        }
+    else
+        while (i < na && j < nb)
+        {
+            int order = xset_order(pa[i], pb[j], comp);
+            if (order > 0)
+                out.emplace_back(pb[j++]);
+            else
+            {
+                if (!order)
+                    j++;
+                out.emplace_back(pa[i++]);
+            }
+        }
+    out.append_range(pa + i, pa + na);
+    out.append_range(pb + j, pb + nb);
+}
+
+/**
+ * @brief Writes the intersection of two sets into out, taking a's elements.
+ *        Sets of int32_t or uint32_t in ascending order are intersected
+ *        with SSE2 where the CPU has it.
+ *
+ * @param a Sorted set.
+ * @param b Sorted set.
+ * @param out Output, emptied and reserved once for the smaller input.
+ * @param comp Comparison the sets are sorted by.
+ */
+template <typename VectorA, typename VectorB, typename VectorOut, typename Compare = less<>>
+void xset_intersection(const VectorA &a, const VectorB &b, VectorOut &out, Compare comp = Compare())
+{
+    out.resize(0);
+    out.reserve(a.size() < b.size() ? a.size() : b.size());
+    xset_intersection_walk(a.begin(), a.size(), b.begin(), b.size(), comp,
+                           [&](const xset_element<const VectorA> *p) { out.emplace_back(*p); });
+}
+
+/**
+ * @brief Writes the elements of set a that are not in set b into out.
+ *
+ * @param a Sorted set.
+ * @param b Sorted set.
+ * @param out Output, emptied and reserved once for a.
+ * @param comp Comparison the sets are sorted by.
+ */
+template <typename VectorA, typename VectorB, typename VectorOut, typename Compare = less<>>
+void xset_difference(const VectorA &a, const VectorB &b, VectorOut &out, Compare comp = Compare())
+{
+    out.resize(0);
+    out.reserve(a.size());
+    xset_difference_walk(a.begin(), a.size(), b.begin(), b.size(), comp,
+                         [&](const xset_element<const VectorA> *p) { out.emplace_back(*p); });
+}
+
+/**
+ * @brief Adds the elements of set b to set a, in place. The merge runs
+ *        backwards from the end of a grown by b's size, so every element of
+ *        a moves at most twice and a is reserved once; when b is much
+ *        smaller, the runs of a between its elements are found by binary
+ *        search and moved as blocks.
+ *
+ * @param a Sorted set, extended in place.
+ * @param b Sorted set.
+ * @param comp Comparison the sets are sorted by.
+ */
+template <typename VectorA, typename VectorB, typename Compare = less<>>
+void xset_unite(VectorA &a, const VectorB &b, Compare comp = Compare())
+{
+    size_t na = a.size();
+    size_t nb = b.size();
+    if (!nb)
+        return;
+    a.reserve(na + nb);
+    a.resize(na + nb);
+    auto *pa = a.begin();
+    const auto *pb = b.begin();
+    size_t i = na;      // a[0, i) is not merged yet
+    size_t w = na + nb; // a[w, na + nb) is the merged tail
+    bool skewed = na > nb * xset_gallop_ratio;
+    for (size_t j = nb; j > 0; j--)
+    {
+        const auto &x = pb[j - 1];
+        if (skewed) // Move the run of a above x in one block
+        {
+            size_t from = lower_bound(pa, pa + i, x, [&](const auto &e, const auto &v) { return !comp(v, e); }) - pa;
+            move_backward(pa + from, pa + i, pa + w);
+            w -= i - from;
+            i = from;
+        }
+        else
+            while (i > 0 && comp(x, pa[i - 1]))
+                pa[--w] = move(pa[--i]);
+        if (i > 0 && !comp(pa[i - 1], x)) // Equal: keep a's element
+        {
+            i--;
+            if (--w != i)
+                pa[w] = move(pa[i]);
+        }
+        else
+            pa[--w] = x;
+    }
+    if (w != i) // Equal pairs left a gap between a's unmerged head and the merged tail
+    {
+        move(pa + w, pa + na + nb, pa + i);
+        a.erase(a.end() - (w - i), a.end());
+    }
+}
+
+/**
+ * @brief Keeps only the elements of set a that are also in set b, in place.
+ *        Sets of int32_t or uint32_t in ascending order are intersected
+ *        with SSE2 where the CPU has it.
+ *
+ * @param a Sorted set, reduced in place.
+ * @param b Sorted set.
+ * @param comp Comparison the sets are sorted by.
+ */
+template <typename VectorA, typename VectorB, typename Compare = less<>>
+void xset_intersect(VectorA &a, const VectorB &b, Compare comp = Compare())
+{
+    auto *pa = a.begin();
+    size_t w = 0;
+    xset_intersection_walk(a.begin(), a.size(), b.begin(), b.size(), comp, [&](const xset_element<VectorA> *p)
+    {
+        if (p != pa + w)
+            pa[w] = move(const_cast<xset_element<VectorA> &>(*p));
+        w++;
+    });
+    a.erase(a.begin() + w, a.end());
+}
+
+/**
+ * @brief Removes the elements of set b from set a, in place.
+ *
+ * @param a Sorted set, reduced in place.
+ * @param b Sorted set.
+ * @param comp Comparison the sets are sorted by.
+ */
+template <typename VectorA, typename VectorB, typename Compare = less<>>
+void xset_subtract(VectorA &a, const VectorB &b, Compare comp = Compare())
+{
+    auto *pa = a.begin();
+    size_t w = 0;
+    xset_difference_walk(a.begin(), a.size(), b.begin(), b.size(), comp, [&](const xset_element<VectorA> *p)
+    {
+        if (p != pa + w)
+            pa[w] = move(const_cast<xset_element<VectorA> &>(*p));
+        w++;
+    });
+    a.erase(a.begin() + w, a.end());
+}
@@ -0,0 +1,547 @@
+/**
+ * @file Xsimd.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Vectorized sum, min, max, dot product and transform over contiguous
+ *        ranges, e.g. the iterators of an Xvector or an Xarray. On x86 the
+ *        AVX2 or SSE2 version is picked at run time from what the CPU
+ *        supports, so one binary runs everywhere; other targets, and element
+ *        types without a vector version, use plain loops.
+ *
+ *        Every kernel uses unaligned loads and stores, and never peels
+ *        elements to reach an aligned address: on AVX2-era CPUs an unaligned
+ *        load of aligned data costs the same as an aligned one, and memory
+ *        from the default allocator is already 16-byte aligned. Large arrays
+ *        whose start is 32-byte aligned avoid loads that straddle two cache
+ *        lines. Elements left over after the last full vector are handled
+ *        one at a time, so any length is accepted.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for int32_t, uint64_t
+#include <type_traits> // for is_integral, is_same
+using namespace std;
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define XSIMD_X86 1
+#include <immintrin.h> // for SSE2 and AVX2 intrinsics
+#define XSIMD_SSE2 __attribute__((target("sse2")))
+#define XSIMD_AVX2 __attribute__((target("avx2")))
+#define XSIMD_INLINE __attribute__((always_inline)) inline
+#endif
+
+/**
+ * @brief Instruction sets the kernels can run on, from slowest to fastest.
+ *
+ */
+enum class xsimd_isa
+{
+    scalar,
+    sse2,
+    avx2
+};
+
+/**
+ * @brief Returns the fastest instruction set this CPU supports.
+ *
+ * @return xsimd_isa
+ */
+inline xsimd_isa xsimd_detect()
+{
+#ifdef XSIMD_X86
+    if (__builtin_cpu_supports("avx2"))
+        return xsimd_isa::avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return xsimd_isa::sse2;
+#endif
+    return xsimd_isa::scalar;
+}
+
+/**
+ * @brief Returns the instruction set the kernels use, detected once on first
+ *        call. Assign a lower level to it to compare versions, e.g. in a
+ *        benchmark; never assign a level the CPU does not support.
+ *
+ * @return xsimd_isa&
+ */
+inline xsimd_isa &xsimd_active()
+{
+    static xsimd_isa isa = xsimd_detect();
+    return isa;
+}
+
+/**
+ * @brief True for element types with vector kernels. Other arithmetic types
+ *        work too, through the plain loops.
+ *
+ * @tparam T type of element.
+ */
+template <typename T>
+constexpr bool xsimd_vectorized = is_same<T, float>::value || is_same<T, double>::value || is_same<T, int32_t>::value;
+
+/**
+ * @brief Adds two elements; integers wrap around like the vector adds do.
+ *
+ */
+template <typename T>
+inline T xsimd_add(T a, T b)
+{
+    if constexpr (is_integral<T>::value)
+        return static_cast<T>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+    else
+        return a + b;
+}
+
+/**
+ * @brief Multiplies two elements; integers wrap around like the vector
+ *        multiplies do.
+ *
+ */
+template <typename T>
+inline T xsimd_mul(T a, T b)
+{
+    if constexpr (is_integral<T>::value)
+        return static_cast<T>(static_cast<uint64_t>(a) * static_cast<uint64_t>(b));
+    else
+        return a * b;
+}
+#ifdef XSIMD_X86
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi" // Vector values only pass between inlined functions
+
+/**
+ * @brief Register operations for one element type on one instruction set:
+ *        reg, width, zero, load, store, add, mul, min and max. The kernels
+ *        below are written once against this interface.
+ *
+ * @tparam T type of element.
+ * @tparam Isa instruction set.
+ */
+template <typename T, xsimd_isa Isa>
+struct xsimd_regs;
+
+template <>
+struct xsimd_regs<float, xsimd_isa::sse2>
+{
+    using reg = __m128;
+    static constexpr size_t width = 4;
+    XSIMD_SSE2 static reg zero() { return _mm_setzero_ps(); }
+    XSIMD_SSE2 static reg load(const float *p) { return _mm_loadu_ps(p); }
+    XSIMD_SSE2 static void store(float *p, reg a) { _mm_storeu_ps(p, a); }
+    XSIMD_SSE2 static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+    XSIMD_SSE2 static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+    XSIMD_SSE2 static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+    XSIMD_SSE2 static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+};
+
+template <>
+struct xsimd_regs<double, xsimd_isa::sse2>
+{
+    using reg = __m128d;
+    static constexpr size_t width = 2;
+    XSIMD_SSE2 static reg zero() { return _mm_setzero_pd(); }
+    XSIMD_SSE2 static reg load(const double *p) { return _mm_loadu_pd(p); }
+    XSIMD_SSE2 static void store(double *p, reg a) { _mm_storeu_pd(p, a); }
+    XSIMD_SSE2 static reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+    XSIMD_SSE2 static reg mul(reg a, reg b) { return _mm_mul_pd(a, b); }
+    XSIMD_SSE2 static reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+    XSIMD_SSE2 static reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+};
+
+template <>
+struct xsimd_regs<int32_t, xsimd_isa::sse2>
+{
+    using reg = __m128i;
+    static constexpr size_t width = 4;
+    XSIMD_SSE2 static reg zero() { return _mm_setzero_si128(); }
+    XSIMD_SSE2 static reg load(const int32_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+    XSIMD_SSE2 static void store(int32_t *p, reg a) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), a); }
+    XSIMD_SSE2 static reg add(reg a, reg b) { return _mm_add_epi32(a, b); }
+    XSIMD_SSE2 static reg mul(reg a, reg b) // SSE2 has no 32-bit multiply: two 2-lane multiplies, then interleave
+    {
+        __m128i even = _mm_mul_epu32(a, b);
+        __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                  _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    }
+    XSIMD_SSE2 static reg min(reg a, reg b) // SSE2 has no 32-bit min/max: select through a compare mask
+    {
+        __m128i a_greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(a_greater, b), _mm_andnot_si128(a_greater, a));
+    }
+    XSIMD_SSE2 static reg max(reg a, reg b)
+    {
+        __m128i a_greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(a_greater, a), _mm_andnot_si128(a_greater, b));
+    }
+};
+
+template <>
+struct xsimd_regs<float, xsimd_isa::avx2>
+{
+    using reg = __m256;
+    static constexpr size_t width = 8;
+    XSIMD_AVX2 static reg zero() { return _mm256_setzero_ps(); }
+    XSIMD_AVX2 static reg load(const float *p) { return _mm256_loadu_ps(p); }
+    XSIMD_AVX2 static void store(float *p, reg a) { _mm256_storeu_ps(p, a); }
+    XSIMD_AVX2 static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+    XSIMD_AVX2 static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+    XSIMD_AVX2 static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+    XSIMD_AVX2 static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+};
+
+template <>
+struct xsimd_regs<double, xsimd_isa::avx2>
+{
+    using reg = __m256d;
+    static constexpr size_t width = 4;
+    XSIMD_AVX2 static reg zero() { return _mm256_setzero_pd(); }
+    XSIMD_AVX2 static reg load(const double *p) { return _mm256_loadu_pd(p); }
+    XSIMD_AVX2 static void store(double *p, reg a) { _mm256_storeu_pd(p, a); }
+    XSIMD_AVX2 static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    XSIMD_AVX2 static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+    XSIMD_AVX2 static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+    XSIMD_AVX2 static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+};
+
+template <>
+struct xsimd_regs<int32_t, xsimd_isa::avx2>
+{
+    using reg = __m256i;
+    static constexpr size_t width = 8;
+    XSIMD_AVX2 static reg zero() { return _mm256_setzero_si256(); }
+    XSIMD_AVX2 static reg load(const int32_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+    XSIMD_AVX2 static void store(int32_t *p, reg a) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), a); }
+    XSIMD_AVX2 static reg add(reg a, reg b) { return _mm256_add_epi32(a, b); }
+    XSIMD_AVX2 static reg mul(reg a, reg b) { return _mm256_mullo_epi32(a, b); }
+    XSIMD_AVX2 static reg min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+    XSIMD_AVX2 static reg max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+};
+
+/**
+ * @brief Sums n elements with two vector accumulators, to hide the latency
+ *        of the add. Inlined into each instruction set's wrapper, which
+ *        supplies the target.
+ *
+ */
+template <typename R, typename T>
+XSIMD_INLINE T xsimd_sum_kernel(const T *p, size_t n)
+{
+    typename R::reg a0 = R::zero();
+    typename R::reg a1 = R::zero();
+    size_t i = 0;
+    for (; i + 2 * R::width <= n; i += 2 * R::width)
+    {
+        a0 = R::add(a0, R::load(p + i));
+        a1 = R::add(a1, R::load(p + i + R::width));
+    }
+    if (i + R::width <= n)
+    {
+        a0 = R::add(a0, R::load(p + i));
+        i += R::width;
+    }
+    T lanes[R::width];
+    R::store(lanes, R::add(a0, a1));
+    T sum = 0;
+    for (T x : lanes)
+        sum = xsimd_add(sum, x);
+    for (; i < n; i++) // Tail
+        sum = xsimd_add(sum, p[i]);
+    return sum;
+}
+
+/**
+ * @brief Multiplies two arrays element by element and sums the products,
+ *        with two vector accumulators.
+ *
+ */
+template <typename R, typename T>
+XSIMD_INLINE T xsimd_dot_kernel(const T *a, const T *b, size_t n)
+{
+    typename R::reg a0 = R::zero();
+    typename R::reg a1 = R::zero();
+    size_t i = 0;
+    for (; i + 2 * R::width <= n; i += 2 * R::width)
+    {
+        a0 = R::add(a0, R::mul(R::load(a + i), R::load(b + i)));
+        a1 = R::add(a1, R::mul(R::load(a + i + R::width), R::load(b + i + R::width)));
+    }
+    if (i + R::width <= n)
+    {
+        a0 = R::add(a0, R::mul(R::load(a + i), R::load(b + i)));
+        i += R::width;
+    }
+    T lanes[R::width];
+    R::store(lanes, R::add(a0, a1));
+    T sum = 0;
+    for (T x : lanes)
+        sum = xsimd_add(sum, x);
+    for (; i < n; i++) // Tail
+        sum = xsimd_add(sum, xsimd_mul(a[i], b[i]));
+    return sum;
+}
+
+/**
+ * @brief Finds the smallest (Max false) or largest (Max true) of n >= 1
+ *        elements.
+ *
+ */
+template <typename R, bool Max, typename T>
+XSIMD_INLINE T xsimd_extreme_kernel(const T *p, size_t n)
+{
+    auto pick = [](T a, T b) { return Max ? (b > a ? b : a) : (b < a ? b : a); };
+    T best = p[0];
+    size_t i = 0;
+    if (n >= R::width)
+    {
+        typename R::reg acc = R::load(p);
+        for (i = R::width; i + R::width <= n; i += R::width)
+            acc = Max ? R::max(acc, R::load(p + i)) : R::min(acc, R::load(p + i));
+        T lanes[R::width];
+        R::store(lanes, acc);
+        for (T x : lanes)
+            best = pick(best, x);
+    }
+    for (; i < n; i++) // Tail
+        best = pick(best, p[i]);
+    return best;
+}
+
+/**
+ * @brief Applies op to n elements in fixed-size blocks. The inner loop has
+ *        a constant trip count and the arrays are declared not to overlap,
+ *        which lets the compiler vectorize it with the wrapper's instruction
+ *        set even at -O2.
+ *
+ */
+template <typename T, typename U, typename Op>
+XSIMD_INLINE void xsimd_transform_kernel(const T *__restrict in, size_t n, U *__restrict out, Op &op)
+{
+    constexpr size_t block = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+    size_t i = 0;
+    for (; i + block <= n; i += block)
+        for (size_t j = 0; j < block; j++)
+            out[i + j] = op(in[i + j]);
+    for (; i < n; i++) // Tail
+        out[i] = op(in[i]);
+}
+
+/**
+ * @brief Applies op to n elements in place, in fixed-size blocks.
+ *
+ */
+template <typename T, typename Op>
+XSIMD_INLINE void xsimd_transform_inplace_kernel(T *p, size_t n, Op &op)
+{
+    constexpr size_t block = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+    size_t i = 0;
+    for (; i + block <= n; i += block)
+        for (size_t j = 0; j < block; j++)
+            p[i + j] = op(p[i + j]);
+    for (; i < n; i++) // Tail
+        p[i] = op(p[i]);
+}
+
+template <typename T>
+XSIMD_SSE2 T xsimd_sum_sse2(const T *p, size_t n) { return xsimd_sum_kernel<xsimd_regs<T, xsimd_isa::sse2>>(p, n); }
+
+template <typename T>
+XSIMD_AVX2 T xsimd_sum_avx2(const T *p, size_t n) { return xsimd_sum_kernel<xsimd_regs<T, xsimd_isa::avx2>>(p, n); }
+
+template <typename T>
+XSIMD_SSE2 T xsimd_dot_sse2(const T *a, const T *b, size_t n) { return xsimd_dot_kernel<xsimd_regs<T, xsimd_isa::sse2>>(a, b, n); }
+
+template <typename T>
+XSIMD_AVX2 T xsimd_dot_avx2(const T *a, const T *b, size_t n) { return xsimd_dot_kernel<xsimd_regs<T, xsimd_isa::avx2>>(a, b, n); }
+
+template <bool Max, typename T>
+XSIMD_SSE2 T xsimd_extreme_sse2(const T *p, size_t n) { return xsimd_extreme_kernel<xsimd_regs<T, xsimd_isa::sse2>, Max>(p, n); }
+
+template <bool Max, typename T>
+XSIMD_AVX2 T xsimd_extreme_avx2(const T *p, size_t n) { return xsimd_extreme_kernel<xsimd_regs<T, xsimd_isa::avx2>, Max>(p, n); }
+
+template <typename T, typename U, typename Op>
+XSIMD_SSE2 void xsimd_transform_sse2(const T *in, size_t n, U *out, Op &op) { xsimd_transform_kernel(in, n, out, op); }
+
+template <typename T, typename U, typename Op>
+XSIMD_AVX2 void xsimd_transform_avx2(const T *in, size_t n, U *out, Op &op) { xsimd_transform_kernel(in, n, out, op); }
+
+template <typename T, typename Op>
+XSIMD_SSE2 void xsimd_transform_inplace_sse2(T *p, size_t n, Op &op) { xsimd_transform_inplace_kernel(p, n, op); }
+
+template <typename T, typename Op>
+XSIMD_AVX2 void xsimd_transform_inplace_avx2(T *p, size_t n, Op &op) { xsimd_transform_inplace_kernel(p, n, op); }
+
+#pragma GCC diagnostic pop
+
+#endif
+
+/**
+ * @brief Returns the sum of the elements in [first, last). Vector versions
+ *        add in a different order than a plain loop, so a floating-point
+ *        result can differ from one in the last bits; integer sums wrap
+ *        around like additions in T.
+ *
+ * @tparam T type of element.
+ * @param first Pointer to the first element, e.g. v.begin().
+ * @param last Pointer one past the last element.
+ * @return T
+ */
+template <typename T>
+T xsimd_sum(const T *first, const T *last)
+{
+    size_t n = last - first;
+#ifdef XSIMD_X86
+    if constexpr (xsimd_vectorized<T>)
+    {
+        if (xsimd_active() == xsimd_isa::avx2)
+            return xsimd_sum_avx2(first, n);
+        if (xsimd_active() == xsimd_isa::sse2)
+            return xsimd_sum_sse2(first, n);
+    }
+#endif
+    T sum = 0;
+    for (size_t i = 0; i < n; i++)
+        sum = xsimd_add(sum, first[i]);
+    return sum;
+}
+
+/**
+ * @brief Returns the smallest element in [first, last), which must not be
+ *        empty. The result is unspecified if the range holds a NaN.
+ *
+ * @tparam T type of element.
+ * @param first Pointer to the first element.
+ * @param last Pointer one past the last element.
+ * @return T
+ */
+template <typename T>
+T xsimd_min(const T *first, const T *last)
+{
+    size_t n = last - first;
+#ifdef XSIMD_X86
+    if constexpr (xsimd_vectorized<T>)
+    {
+        if (xsimd_active() == xsimd_isa::avx2)
+            return xsimd_extreme_avx2<false>(first, n);
+        if (xsimd_active() == xsimd_isa::sse2)
+            return xsimd_extreme_sse2<false>(first, n);
+    }
+#endif
+    T best = first[0];
+    for (size_t i = 1; i < n; i++)
+        if (first[i] < best)
+            best = first[i];
+    return best;
+}
+
+/**
+ * @brief Returns the largest element in [first, last), which must not be
+ *        empty. The result is unspecified if the range holds a NaN.
+ *
+ * @tparam T type of element.
+ * @param first Pointer to the first element.
+ * @param last Pointer one past the last element.
+ * @return T
+ */
+template <typename T>
+T xsimd_max(const T *first, const T *last)
+{
+    size_t n = last - first;
+#ifdef XSIMD_X86
+    if constexpr (xsimd_vectorized<T>)
+    {
+        if (xsimd_active() == xsimd_isa::avx2)
+            return xsimd_extreme_avx2<true>(first, n);
+        if (xsimd_active() == xsimd_isa::sse2)
+            return xsimd_extreme_sse2<true>(first, n);
+    }
+#endif
+    T best = first[0];
+    for (size_t i = 1; i < n; i++)
+        if (first[i] > best)
+            best = first[i];
+    return best;
+}
+
+/**
+ * @brief Returns the dot product of [first, last) and the array of the same
+ *        length starting at other. Reassociates and wraps like xsimd_sum.
+ *
+ * @tparam T type of element.
+ * @param first Pointer to the first element of the first array.
+ * @param last Pointer one past the last element of the first array.
+ * @param other Pointer to the first element of the second array.
+ * @return T
+ */
+template <typename T>
+T xsimd_dot(const T *first, const T *last, const T *other)
+{
+    size_t n = last - first;
+#ifdef XSIMD_X86
+    if constexpr (xsimd_vectorized<T>)
+    {
+        if (xsimd_active() == xsimd_isa::avx2)
+            return xsimd_dot_avx2(first, other, n);
+        if (xsimd_active() == xsimd_isa::sse2)
+            return xsimd_dot_sse2(first, other, n);
+    }
+#endif
+    T sum = 0;
+    for (size_t i = 0; i < n; i++)
+        sum = xsimd_add(sum, xsimd_mul(first[i], other[i]));
+    return sum;
+}
+
+/**
+ * @brief Writes op(x) for every x in [first, last) to the array starting at
+ *        out, like std::transform. The loop is compiled once per instruction
+ *        set with op inlined, so any element types and any op that the
+ *        compiler can vectorize get the widest vectors the CPU supports. out
+ *        may equal first for an in-place transform, but must not otherwise
+ *        overlap the input.
+ *
+ * @tparam T type of input element.
+ * @tparam U type of output element.
+ * @tparam Op type of callable taking T and returning something convertible
+ *         to U.
+ * @param first Pointer to the first input element.
+ * @param last Pointer one past the last input element.
+ * @param out Pointer to the first output element.
+ * @param op Callable to be applied.
+ * @return U* pointer one past the last element written.
+ */
+template <typename T, typename U, typename Op>
+U *xsimd_transform(const T *first, const T *last, U *out, Op op)
+{
+    size_t n = last - first;
+#ifdef XSIMD_X86
+    if constexpr (is_same<T, U>::value)
+        if (static_cast<const void *>(out) == static_cast<const void *>(first))
+        {
+            if (xsimd_active() == xsimd_isa::avx2)
+                xsimd_transform_inplace_avx2(out, n, op);
+            else if (xsimd_active() == xsimd_isa::sse2)
+                xsimd_transform_inplace_sse2(out, n, op);
+            else
+                for (size_t i = 0; i < n; i++)
+                    out[i] = op(out[i]);
+            return out + n;
+        }
+    if (xsimd_active() == xsimd_isa::avx2)
+        xsimd_transform_avx2(first, n, out, op);
+    else if (xsimd_active() == xsimd_isa::sse2)
+        xsimd_transform_sse2(first, n, out, op);
+    else
+#endif
+        for (size_t i = 0; i < n; i++)
+            out[i] = op(first[i]);
+    return out + n;
+}
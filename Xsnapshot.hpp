@@ -0,0 +1,438 @@
+/**
+ * @file Xsnapshot.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Binary snapshot of a list of strings: a header, a table of offsets
+ *        and the characters of every string back to back. A snapshot is
+ *        written with a single write and loaded by mapping it, so a word list
+ *        that was parsed once can be reopened in milliseconds.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>     // for size_t, ptrdiff_t
+#include <cstdint>     // for uint32_t, uint64_t
+#include <cstdio>      // for FILE, fopen, fwrite, rename
+#include <cstring>     // for memcpy, memcmp
+#include <iterator>    // for random_access_iterator_tag
+#include <optional>    // for optional
+#include <stdexcept>   // for basic exceptions
+#include <string>      // for string
+#include <string_view> // for string_view
+#include <sys/stat.h>  // for stat
+#include "Xvector.hpp"
+#include "XmappedFile.hpp"
+using namespace std;
+
+/**
+ * @brief Format version written into every snapshot. Bump it whenever the
+ *        layout changes, so older snapshots are rejected instead of misread.
+ *
+ */
+constexpr uint32_t xsnapshot_version = 2;
+
+/**
+ * @brief Layout of the first 64 bytes of a snapshot. The offsets table
+ *        follows it, count + 1 entries of offset_bytes each, and then the
+ *        characters. String i spans [offset i, offset i + 1) of the characters.
+ *
+ */
+struct xsnapshot_header
+{
+    char magic[8];         // "XSNAPSHT"
+    uint32_t version;      // xsnapshot_version
+    uint32_t offset_bytes; // Width of each offset, 4 or 8
+    uint64_t count;        // Number of strings
+    uint64_t blob_bytes;   // Number of characters in all strings
+    uint64_t source_tag;   // Identifies the input the snapshot was built from
+    uint64_t checksum;     // xsnapshot_image_checksum of the header and the rest
+    uint64_t unused[2];    // Pads the header to 64 bytes
+};
+static_assert(sizeof(xsnapshot_header) == 64, "xsnapshot_header must stay 64 bytes");
+
+/**
+ * @brief Hashes a block of bytes, 32 bytes per step in four independent
+ *        lanes so it runs close to memory speed. Catches truncated and
+ *        corrupted snapshots; it is not a cryptographic hash.
+ *
+ * @param data Pointer to the bytes.
+ * @param bytes Number of bytes.
+ * @param seed Starting value.
+ * @return uint64_t
+ */
+inline uint64_t xsnapshot_checksum(const void *data, size_t bytes, uint64_t seed = 0)
+{
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    const uint64_t k1 = 0x9E3779B185EBCA87ULL;
+    const uint64_t k2 = 0xC2B2AE3D27D4EB4FULL;
+    auto mix = [&](uint64_t h, uint64_t w)
+    {
+        h ^= w * k2;
+        h = (h << 31) | (h >> 33);
+        return h * k1;
+    };
+
+    uint64_t lanes[4] = {seed + k1, seed ^ k2, seed - k1, ~seed};
+    size_t i = 0;
+    for (; i + 32 <= bytes; i += 32)
+        for (size_t j = 0; j < 4; j++)
+        {
+            uint64_t w;
+            memcpy(&w, p + i + 8 * j, 8);
+            lanes[j] = mix(lanes[j], w);
+        }
+
+    uint64_t h = bytes;
+    for (uint64_t lane : lanes)
+        h = mix(h, lane);
+    for (; i + 8 <= bytes; i += 8)
+    {
+        uint64_t w;
+        memcpy(&w, p + i, 8);
+        h = mix(h, w);
+    }
+    if (i < bytes)
+    {
+        uint64_t w = 0;
+        memcpy(&w, p + i, bytes - i);
+        h = mix(h, w);
+    }
+    h ^= h >> 33;
+    h *= k2;
+    h ^= h >> 29;
+    return h;
+}
+
+/**
+ * @brief Hashes a snapshot header, with its checksum field taken as 0, and
+ *        then the offsets table and characters, so a damaged source_tag or
+ *        a count and blob_bytes changed together fail verification just like
+ *        damaged strings.
+ *
+ * @param head Header of the snapshot.
+ * @param body Pointer to the offsets table, followed by the characters.
+ * @param bytes Number of bytes after the header.
+ * @return uint64_t
+ */
+inline uint64_t xsnapshot_image_checksum(xsnapshot_header head, const void *body, size_t bytes)
+{
+    head.checksum = 0;
+    return xsnapshot_checksum(body, bytes, xsnapshot_checksum(&head, sizeof(head)));
+}
+
+/**
+ * @brief Returns a tag for the current version of a file, built from its
+ *        size and modification time without reading it. Store it in a
+ *        snapshot built from that file, and a later edit makes the snapshot
+ *        stale.
+ *
+ * @param path Path of the source file.
+ * @return uint64_t tag, 0 if the file cannot be examined.
+ */
+inline uint64_t xsnapshot_file_tag(const char *path)
+{
+    struct stat st;
+    if (stat(path, &st) != 0)
+        return 0;
+    uint64_t fields[3] = {uint64_t(st.st_size), uint64_t(st.st_mtime), 0};
+#if defined(__linux__)
+    fields[2] = uint64_t(st.st_mtim.tv_nsec);
+#endif
+    return xsnapshot_checksum(fields, sizeof(fields), 1);
+}
+
+/**
+ * @brief Writes a snapshot of a list of strings. The whole image is built in
+ *        memory and handed to the file in one write, to a temporary file that
+ *        is then renamed over the path, so readers never see a partial
+ *        snapshot. Throws std::runtime_error if the file cannot be written.
+ *
+ * @tparam ForwardIt type of iterator, its elements convert to string_view.
+ * @param path Path of the snapshot.
+ * @param first Iterator to the first string.
+ * @param last Iterator one past the last string.
+ * @param source_tag Tag of the input, e.g. xsnapshot_file_tag(source).
+ */
+template <typename ForwardIt>
+void xsnapshot_save(const char *path, ForwardIt first, ForwardIt last, uint64_t source_tag = 0)
+{
+    size_t count = 0;
+    size_t blob_bytes = 0;
+    for (ForwardIt it = first; it != last; ++it, ++count)
+        blob_bytes += string_view(*it).size();
+
+    uint32_t width = blob_bytes <= UINT32_MAX ? 4 : 8; // Narrow offsets halve the table for lists under 4 GiB
+    size_t table_bytes = (count + 1) * width;
+    Xvector<char> image;
+    image.resize_for_overwrite(sizeof(xsnapshot_header) + table_bytes + blob_bytes);
+
+    char *table = image.begin() + sizeof(xsnapshot_header);
+    char *blob = table + table_bytes;
+    uint64_t pos = 0;
+    auto put_offset = [&](size_t i)
+    {
+        if (width == 4)
+        {
+            uint32_t narrow = static_cast<uint32_t>(pos);
+            memcpy(table + i * 4, &narrow, 4);
+        }
+        else
+            memcpy(table + i * 8, &pos, 8);
+    };
+    for (size_t i = 0; first != last; ++first, ++i)
+    {
+        string_view s = *first;
+        put_offset(i);
+        memcpy(blob + pos, s.data(), s.size());
+        pos += s.size();
+    }
+    put_offset(count);
+
+    xsnapshot_header head{};
+    memcpy(head.magic, "XSNAPSHT", 8);
+    head.version = xsnapshot_version;
+    head.offset_bytes = width;
+    head.count = count;
+    head.blob_bytes = blob_bytes;
+    head.source_tag = source_tag;
+    head.checksum = xsnapshot_image_checksum(head, table, table_bytes + blob_bytes);
+    memcpy(image.begin(), &head, sizeof(head));
+
+    string tmp = string(path) + ".tmp";
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (!f)
+        throw runtime_error("xsnapshot_save: cannot open " + tmp);
+    setvbuf(f, nullptr, _IONBF, 0); // One write straight from the image
+    bool ok = fwrite(image.begin(), 1, image.size(), f) == image.size();
+    ok = fclose(f) == 0 && ok;
+    if (!ok || rename(tmp.c_str(), path) != 0)
+    {
+        remove(tmp.c_str());
+        throw runtime_error(string("xsnapshot_save: cannot write ") + path);
+    }
+}
+
+/**
+ * @brief A read-only list of strings backed by a mapped snapshot. Strings
+ *        are string_views into the mapping and stay valid while the snapshot
+ *        is loaded.
+ *
+ */
+class Xsnapshot
+{
+private:
+    optional<XmappedFile> file; // Mapping of the snapshot, empty if none is loaded
+    const char *table{nullptr}; // Offsets table
+    const char *blob{nullptr};  // Characters of every string
+    size_t count{0};            // Number of strings
+    uint32_t width{4};          // Width of each offset
+    uint64_t tag{0};            // Source tag stored in the snapshot
+
+    /**
+     * @brief Returns the i-th entry of the offsets table.
+     *
+     * @param i Index of the entry, at most size().
+     * @return size_t
+     */
+    size_t offset(size_t i) const;
+
+public:
+    /**
+     * @brief Random access iterator yielding each string as a string_view.
+     *
+     */
+    class const_iterator
+    {
+    private:
+        const Xsnapshot *snap{nullptr};
+        size_t pos{0};
+
+    public:
+        using iterator_category = random_access_iterator_tag;
+        using value_type = string_view;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = string_view;
+
+        const_iterator() {}
+        const_iterator(const Xsnapshot *_snap, size_t _pos) : snap(_snap), pos(_pos) {}
+
+        string_view operator*() const { return (*snap)[pos]; }
+        string_view operator[](difference_type n) const { return (*snap)[pos + n]; }
+
+        const_iterator &operator++() { pos++; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; pos++; return tmp; }
+        const_iterator &operator--() { pos--; return *this; }
+        const_iterator operator--(int) { const_iterator tmp = *this; pos--; return tmp; }
+        const_iterator &operator+=(difference_type n) { pos += n; return *this; }
+        const_iterator &operator-=(difference_type n) { pos -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(snap, pos + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(snap, pos - n); }
+        difference_type operator-(const const_iterator &other) const { return difference_type(pos) - difference_type(other.pos); }
+
+        bool operator==(const const_iterator &other) const { return pos == other.pos; }
+        bool operator!=(const const_iterator &other) const { return pos != other.pos; }
+        bool operator<(const const_iterator &other) const { return pos < other.pos; }
+        bool operator>(const const_iterator &other) const { return pos > other.pos; }
+        bool operator<=(const const_iterator &other) const { return pos <= other.pos; }
+        bool operator>=(const const_iterator &other) const { return pos >= other.pos; }
+    };
+
+    using iterator = const_iterator;
+
+    /**
+     * @brief Maps a snapshot and checks it. Returns false, leaving the object
+     *        empty, if the file is missing, is not a snapshot, was written by
+     *        another format version, was built from a different source, or
+     *        (when verifying) fails its checksum.
+     *
+     * @param path Path of the snapshot.
+     * @param expected_tag Tag of the current source, e.g.
+     *        xsnapshot_file_tag(source).
+     * @param verify If true, the checksum is recomputed, which reads the
+     *        whole file; if false, opening costs the same for any size but
+     *        the offsets are trusted as written.
+     * @return true if the snapshot was loaded, false otherwise.
+     */
+    bool load(const char *path, uint64_t expected_tag, bool verify = true);
+
+    /**
+     * @brief Tests if the snapshot holds no strings.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of strings.
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the total number of characters in all strings.
+     *
+     * @return size_t
+     */
+    size_t bytes_size() const;
+
+    /**
+     * @brief Returns the source tag stored in the snapshot.
+     *
+     * @return uint64_t
+     */
+    uint64_t source_tag() const;
+
+    /**
+     * @brief Returns a view of the string at the given index.
+     *
+     * @param pos Index of the string.
+     * @return string_view
+     */
+    string_view operator[](size_t pos) const;
+
+    /**
+     * @brief Returns a view of the string at the given index. Throws
+     *        std::out_of_range if the index is not within the snapshot.
+     *
+     * @param pos Index of the string.
+     * @return string_view
+     */
+    string_view at(size_t pos) const;
+
+    /**
+     * @brief Returns an iterator to the first string.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns an iterator one past the last string.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const;
+};
+
+inline size_t Xsnapshot::offset(size_t i) const
+{
+    if (width == 4)
+    {
+        uint32_t narrow;
+        memcpy(&narrow, table + i * 4, 4);
+        return narrow;
+    }
+    uint64_t wide;
+    memcpy(&wide, table + i * 8, 8);
+    return static_cast<size_t>(wide);
+}
+
+inline bool Xsnapshot::load(const char *path, uint64_t expected_tag, bool verify)
+{
+    file.reset();
+    count = 0;
+    try
+    {
+        file.emplace(path, false); // Lazy mapping: pages are read only when used
+    }
+    catch (const runtime_error &)
+    {
+        return false;
+    }
+
+    xsnapshot_header head;
+    bool ok = file->size() >= sizeof(head);
+    if (ok)
+    {
+        memcpy(&head, file->data(), sizeof(head));
+        ok = memcmp(head.magic, "XSNAPSHT", 8) == 0 && head.version == xsnapshot_version &&
+             (head.offset_bytes == 4 || head.offset_bytes == 8) && head.source_tag == expected_tag &&
+             head.count < file->size() && // Bounds the multiplication below
+             sizeof(head) + (head.count + 1) * head.offset_bytes + head.blob_bytes == file->size();
+    }
+    if (ok && verify)
+        ok = xsnapshot_image_checksum(head, file->data() + sizeof(head), file->size() - sizeof(head)) == head.checksum;
+    if (!ok)
+    {
+        file.reset();
+        return false;
+    }
+
+    table = file->data() + sizeof(head);
+    blob = table + (head.count + 1) * head.offset_bytes;
+    count = head.count;
+    width = head.offset_bytes;
+    tag = head.source_tag;
+    return true;
+}
+
+inline bool Xsnapshot::empty() const { return !count; }
+
+inline size_t Xsnapshot::size() const { return count; }
+
+inline size_t Xsnapshot::bytes_size() const { return count ? offset(count) : 0; }
+
+inline uint64_t Xsnapshot::source_tag() const { return tag; }
+
+inline string_view Xsnapshot::operator[](size_t pos) const
+{
+    size_t start = offset(pos);
+    return string_view(blob + start, offset(pos + 1) - start);
+}
+
+inline string_view Xsnapshot::at(size_t pos) const
+{
+    if (pos >= count)
+        throw out_of_range("Xsnapshot::at: index out of range");
+    return (*this)[pos];
+}
+
+inline Xsnapshot::const_iterator Xsnapshot::begin() const { return const_iterator(this, 0); }
+
+inline Xsnapshot::const_iterator Xsnapshot::end() const { return const_iterator(this, count); }
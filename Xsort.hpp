@@ -0,0 +1,497 @@
+/**
+ * @file Xsort.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Parallel sorting of an Xvector. Any element type is sorted with a
+ *        parallel merge sort; vectors of string or string_view in their
+ *        natural order take a string sort (MSD radix, then multikey
+ *        quicksort) that looks at each character about once instead of
+ *        comparing whole strings again at every level. Results are
+ *        deterministic: the same input and thread count always give the same
+ *        order, and the stable versions give the one stable order for any
+ *        thread count.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>   // for sort, stable_sort, merge, move, fill, copy
+#include <atomic>      // for atomic
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint16_t
+#include <cstring>     // for memcmp
+#include <functional>  // for less
+#include <iterator>    // for make_move_iterator
+#include <string>      // for string
+#include <string_view> // for string_view
+#include <thread>      // for thread
+#include <type_traits> // for enable_if, is_integral, is_same
+#include <utility>     // for move, swap
+#include <vector>      // for vector of threads
+#include "Xvector.hpp"
+using namespace std;
+
+/**
+ * @brief One string being sorted by the string path: its characters and its
+ *        position in the input, which breaks ties for a stable sort and
+ *        tells the final permutation where to fetch the string from.
+ *
+ */
+struct xsort_key
+{
+    const unsigned char *chars; // Characters of the string
+    size_t length;              // Length of the string
+    size_t index;               // Position in the input
+};
+
+const size_t xsort_radix_min = 1 << 8;  // Smaller ranges use multikey quicksort
+const size_t xsort_small = 16;          // Smaller ranges use insertion sort
+
+/**
+ * @brief Returns the character of a key at a depth, or -1 past its end, so
+ *        a string sorts before its extensions.
+ *
+ */
+inline int xsort_char(const xsort_key &k, size_t depth)
+{
+    return depth < k.length ? k.chars[depth] : -1;
+}
+
+/**
+ * @brief Compares two keys whose first depth characters are equal; with
+ *        stable, equal strings are ordered by input position.
+ *
+ */
+inline bool xsort_key_less(const xsort_key &a, const xsort_key &b, size_t depth, bool stable)
+{
+    size_t common = (a.length < b.length ? a.length : b.length) - depth;
+    int c = common ? memcmp(a.chars + depth, b.chars + depth, common) : 0;
+    if (c)
+        return c < 0;
+    if (a.length != b.length)
+        return a.length < b.length;
+    return stable && a.index < b.index;
+}
+
+/**
+ * @brief Sorts a few keys whose first depth characters are equal.
+ *
+ */
+inline void xsort_insertion(xsort_key *a, size_t n, size_t depth, bool stable)
+{
+    for (size_t i = 1; i < n; i++)
+    {
+        xsort_key x = a[i];
+        size_t j = i;
+        for (; j > 0 && xsort_key_less(x, a[j - 1], depth, stable); j--)
+            a[j] = a[j - 1];
+        a[j] = x;
+    }
+}
+
+/**
+ * @brief Distributes keys whose first depth characters are equal into 257
+ *        buckets by their next character, bucket 0 holding the strings that
+ *        end at depth. Each character is read once and kept in buckets, and
+ *        the pass is stable, so keys keep their order within a bucket.
+ *
+ * @param a Keys to distribute, rearranged in bucket order.
+ * @param tmp Scratch space for n keys.
+ * @param buckets Scratch space for n buckets.
+ * @param n Number of keys.
+ * @param depth Position of the character to distribute by.
+ * @param count Set to the size of each bucket.
+ */
+inline void xsort_radix_pass(xsort_key *a, xsort_key *tmp, uint16_t *buckets, size_t n, size_t depth, size_t *count)
+{
+    fill(count, count + 257, 0);
+    for (size_t i = 0; i < n; i++)
+    {
+        buckets[i] = static_cast<uint16_t>(xsort_char(a[i], depth) + 1);
+        count[buckets[i]]++;
+    }
+    size_t start[257];
+    size_t sum = 0;
+    for (size_t b = 0; b < 257; b++)
+    {
+        start[b] = sum;
+        sum += count[b];
+    }
+    for (size_t i = 0; i < n; i++)
+        tmp[start[buckets[i]]++] = a[i];
+    copy(tmp, tmp + n, a);
+}
+
+/**
+ * @brief Sorts keys whose first depth characters are equal, by one
+ *        character position at a time: MSD radix on large ranges, multikey
+ *        quicksort (three-way partition on one character) on smaller ones.
+ *        Keys that share a character move on to the next position together,
+ *        so no prefix is compared twice.
+ *
+ * @param a Keys to sort.
+ * @param tmp Scratch space for n keys, used by the radix passes.
+ * @param buckets Scratch space for n buckets, used by the radix passes.
+ * @param n Number of keys.
+ * @param depth Number of leading characters known to be equal.
+ * @param stable If true, equal strings keep their input order.
+ */
+inline void xsort_strings(xsort_key *a, xsort_key *tmp, uint16_t *buckets, size_t n, size_t depth, bool stable)
+{
+    while (n > xsort_small)
+    {
+        if (n >= xsort_radix_min)
+        {
+            size_t count[257];
+            xsort_radix_pass(a, tmp, buckets, n, depth, count);
+            size_t big = 0, big_pos = 0; // Largest bucket, looped on below
+            for (size_t b = 1, pos = count[0]; b < 257; pos += count[b], b++)
+                if (count[b] > count[big])
+                {
+                    big = b;
+                    big_pos = pos;
+                }
+            for (size_t b = 1, pos = count[0]; b < 257; pos += count[b], b++)
+                if (b != big && count[b] > 1)
+                    xsort_strings(a + pos, tmp + pos, buckets + pos, count[b], depth + 1, stable);
+            if (!big) // Bucket 0 holds the most keys: equal strings, already in input order
+                return;
+            a += big_pos; // Every other bucket is at most half, so only the largest may be deep
+            tmp += big_pos;
+            buckets += big_pos;
+            n = count[big];
+            depth++;
+            continue;
+        }
+
+        int x = xsort_char(a[0], depth), y = xsort_char(a[n / 2], depth), z = xsort_char(a[n - 1], depth);
+        int pivot = x < y ? (y < z ? y : (x < z ? z : x)) : (x < z ? x : (y < z ? z : y)); // Median of three
+        size_t lt = 0, i = 0, gt = n;
+        while (i < gt)
+        {
+            int c = xsort_char(a[i], depth);
+            if (c < pivot)
+                swap(a[lt++], a[i++]);
+            else if (c > pivot)
+                swap(a[i], a[--gt]);
+            else
+                i++;
+        }
+        xsort_strings(a, tmp, buckets, lt, depth, stable);
+        xsort_strings(a + gt, tmp + gt, buckets + gt, n - gt, depth, stable);
+        if (pivot < 0) // Equal strings: only their input order is left to settle
+        {
+            if (stable)
+                sort(a + lt, a + gt, [](const xsort_key &p, const xsort_key &q) { return p.index < q.index; });
+            return;
+        }
+        a += lt; // Loop on the middle instead of recursing, so long shared prefixes do not deepen the stack
+        tmp += lt;
+        buckets += lt;
+        n = gt - lt;
+        depth++;
+    }
+    xsort_insertion(a, n, depth, stable);
+}
+
+/**
+ * @brief Sorts a vector of string or string_view by running the string
+ *        sort on keys, then putting the elements in key order. The first
+ *        character splits the keys into buckets, large buckets are split
+ *        again, and threads take the buckets largest first; each bucket is
+ *        sorted the same way whichever thread takes it, so the result does
+ *        not depend on the thread count.
+ *
+ */
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void xsort_string_path(Xvector<T, Alloc, Growth, InlineCap, Track> &v, size_t threads, bool stable)
+{
+    size_t n = v.size();
+    Xvector<xsort_key> keys;
+    keys.resize_for_overwrite(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        string_view s(v[i]);
+        keys[i] = {reinterpret_cast<const unsigned char *>(s.data()), s.size(), i};
+    }
+    Xvector<xsort_key> tmp;
+    tmp.resize_for_overwrite(n);
+    Xvector<uint16_t> buckets;
+    buckets.resize_for_overwrite(n);
+
+    if (threads <= 1 || n < threads * xsort_radix_min)
+        xsort_strings(keys.begin(), tmp.begin(), buckets.begin(), n, 0, stable);
+    else
+    {
+        struct task
+        {
+            size_t begin, n, depth;
+        };
+        Xvector<task> tasks;
+        tasks.push_back({0, n, 0});
+        for (size_t split = 0; split < tasks.size();) // Radix-split any task too big for one thread's share
+        {
+            task t = tasks[split];
+            if (t.n < n / threads || t.n < xsort_radix_min)
+            {
+                split++;
+                continue;
+            }
+            size_t count[257];
+            xsort_radix_pass(keys.begin() + t.begin, tmp.begin() + t.begin, buckets.begin() + t.begin, t.n, t.depth,
+                             count);
+            tasks.erase(tasks.begin() + split); // Its buckets replace it; bucket 0 is already in order
+            for (size_t b = 1, pos = t.begin + count[0]; b < 257; pos += count[b], b++)
+                if (count[b] > 1)
+                    tasks.push_back({pos, count[b], t.depth + 1});
+        }
+        sort(tasks.begin(), tasks.end(), [](const task &p, const task &q) { return p.n > q.n; });
+
+        atomic<size_t> next{0};
+        vector<thread> workers;
+        for (size_t w = 0; w < threads; w++)
+            workers.emplace_back([&]
+            {
+                for (size_t i; (i = next.fetch_add(1)) < tasks.size();)
+                {
+                    size_t begin = tasks[i].begin;
+                    xsort_strings(keys.begin() + begin, tmp.begin() + begin, buckets.begin() + begin, tasks[i].n,
+                                  tasks[i].depth, stable);
+                }
+            });
+        for (thread &w : workers)
+            w.join();
+    }
+
+    if constexpr (is_same<T, string_view>::value)
+        for (size_t i = 0; i < n; i++)
+            v[i] = string_view(reinterpret_cast<const char *>(keys[i].chars), keys[i].length);
+    else
+        for (size_t i = 0; i < n; i++) // Follow each cycle of the permutation, moving every string once
+        {
+            if (keys[i].index == i)
+                continue;
+            T held = move(v[i]);
+            size_t j = i;
+            while (keys[j].index != i)
+            {
+                size_t from = keys[j].index;
+                v[j] = move(v[from]);
+                keys[j].index = j;
+                j = from;
+            }
+            v[j] = move(held);
+            keys[j].index = j;
+        }
+}
+
+/**
+ * @brief Merges two sorted ranges into out on several threads. The output is
+ *        cut into equal parts, and the split of each cut between the two
+ *        inputs is found by binary search along the diagonal ("merge path"),
+ *        taking from the first range on ties, so the merge is stable and
+ *        its result does not depend on the number of parts.
+ *
+ */
+template <typename T, typename Compare>
+void xsort_merge(T *a, size_t m, T *b, size_t k, T *out, Compare &comp, size_t parts)
+{
+    auto split = [&](size_t diagonal)
+    {
+        size_t lo = diagonal > k ? diagonal - k : 0;
+        size_t hi = diagonal < m ? diagonal : m;
+        while (lo < hi) // Smallest i with b[diagonal - i - 1] < a[i]
+        {
+            size_t i = lo + (hi - lo) / 2;
+            size_t j = diagonal - i;
+            if (j > 0 && !comp(b[j - 1], a[i]))
+                lo = i + 1;
+            else
+                hi = i;
+        }
+        return lo;
+    };
+    Xvector<size_t> cuts; // Found before any part starts moving elements out of a and b
+    for (size_t p = 0; p <= parts; p++)
+        cuts.push_back(split((m + k) * p / parts));
+    auto merge_part = [&](size_t p)
+    {
+        size_t d0 = (m + k) * p / parts, d1 = (m + k) * (p + 1) / parts;
+        size_t i0 = cuts[p], i1 = cuts[p + 1];
+        merge(make_move_iterator(a + i0), make_move_iterator(a + i1), make_move_iterator(b + d0 - i0),
+              make_move_iterator(b + d1 - i1), out + d0, comp);
+    };
+    if (parts <= 1)
+    {
+        merge_part(0);
+        return;
+    }
+    vector<thread> workers;
+    for (size_t p = 1; p < parts; p++)
+        workers.emplace_back(merge_part, p);
+    merge_part(0);
+    for (thread &w : workers)
+        w.join();
+}
+
+/**
+ * @brief Sorts with a comparison on several threads: each thread sorts one
+ *        contiguous slice, then slices are merged in pairs, round after
+ *        round, back and forth between the vector and a buffer, with every
+ *        thread helping in each round.
+ *
+ */
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track, typename Compare>
+void xsort_merge_path(Xvector<T, Alloc, Growth, InlineCap, Track> &v, Compare comp, size_t threads, bool stable)
+{
+    size_t n = v.size();
+    if (threads <= 1 || n < threads * 4096) // Not worth the threads
+    {
+        if (stable)
+            stable_sort(v.begin(), v.end(), comp);
+        else
+            sort(v.begin(), v.end(), comp);
+        return;
+    }
+
+    Xvector<size_t> bounds; // Run i is [bounds[i], bounds[i + 1])
+    for (size_t i = 0; i <= threads; i++)
+        bounds.push_back(n * i / threads);
+    vector<thread> workers;
+    for (size_t i = 0; i < threads; i++)
+        workers.emplace_back([&, i]
+        {
+            if (stable)
+                stable_sort(v.begin() + bounds[i], v.begin() + bounds[i + 1], comp);
+            else
+                sort(v.begin() + bounds[i], v.begin() + bounds[i + 1], comp);
+        });
+    for (thread &w : workers)
+        w.join();
+
+    Xvector<T, Alloc, Growth, InlineCap, Track> buffer(v.get_allocator()); // Same resource, so swapping it into v is safe
+    if constexpr (is_trivially_default_constructible<T>::value)
+        buffer.resize_for_overwrite(n);
+    else
+        buffer.resize(n);
+    T *src = v.begin();
+    T *dst = buffer.begin();
+    while (bounds.size() > 2)
+    {
+        size_t runs = bounds.size() - 1;
+        size_t pairs = runs / 2;
+        size_t parts = threads / pairs ? threads / pairs : 1;
+        Xvector<size_t> merged;
+        vector<thread> mergers;
+        for (size_t r = 0; r + 1 < runs; r += 2)
+        {
+            merged.push_back(bounds[r]);
+            mergers.emplace_back([&, r]
+            {
+                xsort_merge(src + bounds[r], bounds[r + 1] - bounds[r], src + bounds[r + 1],
+                            bounds[r + 2] - bounds[r + 1], dst + bounds[r], comp, parts);
+            });
+        }
+        if (runs % 2) // The odd run out is carried over as is
+        {
+            merged.push_back(bounds[runs - 1]);
+            move(src + bounds[runs - 1], src + n, dst + bounds[runs - 1]);
+        }
+        merged.push_back(n);
+        for (thread &w : mergers)
+            w.join();
+        bounds = move(merged);
+        swap(src, dst);
+    }
+    if (src != v.begin())
+        v.swap(buffer);
+}
+
+/**
+ * @brief True for element types the string path sorts.
+ *
+ */
+template <typename T>
+constexpr bool xsort_is_string = is_same<T, string>::value || is_same<T, string_view>::value;
+
+/**
+ * @brief Sorts a vector in ascending order on several threads. Vectors of
+ *        string or string_view take the string sort; other types are merge
+ *        sorted. Not stable: equal elements may be reordered, though always
+ *        the same way for the same input and thread count.
+ *
+ * @tparam T type of element, default constructible and move assignable.
+ * @param v Vector to sort.
+ * @param threads Number of threads, 0 for one per hardware thread.
+ */
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void xsort(Xvector<T, Alloc, Growth, InlineCap, Track> &v, size_t threads = 0)
+{
+    if (!threads)
+        threads = thread::hardware_concurrency();
+    if constexpr (xsort_is_string<T>)
+        xsort_string_path(v, threads, false);
+    else
+        xsort_merge_path(v, less<T>(), threads, false);
+}
+
+/**
+ * @brief Sorts a vector by a comparison on several threads, with a merge
+ *        sort. Not stable, but deterministic like xsort(v, threads).
+ *
+ * @tparam T type of element, default constructible and move assignable.
+ * @tparam Compare type of comparison, a strict weak ordering.
+ * @param v Vector to sort.
+ * @param comp Comparison, called from several threads at once.
+ * @param threads Number of threads, 0 for one per hardware thread.
+ */
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track, typename Compare,
+          typename enable_if<!is_integral<Compare>::value, int>::type = 0>
+void xsort(Xvector<T, Alloc, Growth, InlineCap, Track> &v, Compare comp, size_t threads = 0)
+{
+    if (!threads)
+        threads = thread::hardware_concurrency();
+    xsort_merge_path(v, comp, threads, false);
+}
+
+/**
+ * @brief Sorts a vector in ascending order on several threads, keeping
+ *        equal elements in their original order. The result is the same for
+ *        any thread count.
+ *
+ * @tparam T type of element, default constructible and move assignable.
+ * @param v Vector to sort.
+ * @param threads Number of threads, 0 for one per hardware thread.
+ */
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void xstable_sort(Xvector<T, Alloc, Growth, InlineCap, Track> &v, size_t threads = 0)
+{
+    if (!threads)
+        threads = thread::hardware_concurrency();
+    if constexpr (xsort_is_string<T>)
+        xsort_string_path(v, threads, true);
+    else
+        xsort_merge_path(v, less<T>(), threads, true);
+}
+
+/**
+ * @brief Sorts a vector by a comparison on several threads, keeping
+ *        elements that compare equal in their original order.
+ *
+ * @tparam T type of element, default constructible and move assignable.
+ * @tparam Compare type of comparison, a strict weak ordering.
+ * @param v Vector to sort.
+ * @param comp Comparison, called from several threads at once.
+ * @param threads Number of threads, 0 for one per hardware thread.
+ */
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track, typename Compare,
+          typename enable_if<!is_integral<Compare>::value, int>::type = 0>
+void xstable_sort(Xvector<T, Alloc, Growth, InlineCap, Track> &v, Compare comp, size_t threads = 0)
+{
+    if (!threads)
+        threads = thread::hardware_concurrency();
+    xsort_merge_path(v, comp, threads, true);
+}
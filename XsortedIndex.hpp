@@ -0,0 +1,375 @@
+/**
+ * @file XsortedIndex.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief A read-only search index over a sorted container of strings, for
+ *        lower_bound, equal_range and prefix queries that miss cache less
+ *        often than a binary search over the strings themselves.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>   // for min
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint32_t, uint64_t, uintptr_t
+#include <stdexcept>   // for basic exceptions
+#include <string>      // for string
+#include <string_view> // for string_view
+#include <utility>     // for pair
+#include "Xvector.hpp"
+using namespace std;
+
+#if defined(__GNUC__)
+#define XSORTED_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define XSORTED_PREFETCH(p) ((void)0)
+#endif
+
+/**
+ * @brief Returns the number of trailing one bits of a number.
+ *
+ * @param k Number, not all ones.
+ * @return size_t
+ */
+inline size_t xsorted_trailing_ones(size_t k)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(~static_cast<unsigned long long>(k));
+#else
+    size_t ones = 0;
+    for (; k & 1; k >>= 1)
+        ones++;
+    return ones;
+#endif
+}
+
+/**
+ * @brief Returns the first 8 bytes of a string as a big-endian integer,
+ *        padded with zero bytes, so comparing two keys compares the strings'
+ *        first 8 bytes in lexicographic order.
+ *
+ * @param s String.
+ * @return uint64_t
+ */
+inline uint64_t xsorted_key(string_view s)
+{
+    uint64_t key = 0;
+    for (size_t i = 0; i < 8; i++)
+        key = key << 8 | (i < s.size() ? static_cast<unsigned char>(s[i]) : 0);
+    return key;
+}
+
+/**
+ * @brief Binary search index over strings sorted in byte order, as
+ *        string_view compares them. The 8-byte key of every string is stored
+ *        in Eytzinger (breadth-first) order: the first levels of the search
+ *        tree share a few cache lines that stay hot, each step of the descent
+ *        moves to a child near its parent, and on large lists the descent
+ *        prefetches the line of the node's 8 descendants three levels down,
+ *        so fetching one level overlaps the comparisons above it. Strings that share
+ *        their first 8 bytes are told apart by comparing the strings in the
+ *        container, with a galloping search from the first of them.
+ *
+ *        Positions returned are ranks in the container, size() meaning the
+ *        end. The container must stay sorted, unchanged and alive while the
+ *        index is in use.
+ *
+ * @tparam Container type of container, e.g. Xvector<string>; operator[]
+ *         must return something that converts to string_view.
+ */
+template <typename Container>
+class XsortedIndex
+{
+private:
+    static constexpr size_t prefetch_min = size_t(1) << 18; // Below 2 MiB of keys they stay in cache and prefetching only costs
+
+    const Container *words{nullptr}; // Strings being indexed, sorted
+    Xvector<uint64_t> key_storage;   // Keys in Eytzinger order, with room to align them
+    size_t key_offset{0};            // Index in key_storage of node 0, 64-byte aligned
+    Xvector<uint32_t> ranks;         // Position in words of each node, 1-based like the nodes
+    size_t count{0};                 // Number of strings
+
+    /**
+     * @brief Returns the keys in Eytzinger order; node k has children 2k and
+     *        2k + 1, and the root is node 1.
+     *
+     * @return const uint64_t*
+     */
+    const uint64_t *keys() const;
+
+    /**
+     * @brief Fills the tree from the given node in order, taking ranks
+     *        from next.
+     *
+     * @param k Node to fill.
+     * @param next Next rank to assign.
+     */
+    void fill(size_t k, size_t &next);
+
+    /**
+     * @brief Returns the rank of the first string whose key is not less
+     *        than the given key, and whether that string's key is equal.
+     *
+     * @param key 8-byte key.
+     * @param tie Set to true if the key at the returned rank equals key.
+     * @return size_t
+     */
+    size_t key_lower_bound(uint64_t key, bool &tie) const;
+
+    /**
+     * @brief Returns the first rank from pos on for which less(string) is
+     *        false, given that it is false for every string after that.
+     *        Doubles its step from pos, then bisects the last step.
+     *
+     * @tparam Less type of predicate.
+     * @param pos Rank to start at.
+     * @param less Predicate on a string_view.
+     * @return size_t
+     */
+    template <typename Less>
+    size_t gallop(size_t pos, Less less) const;
+
+public:
+    /**
+     * @brief Construct a new empty XsortedIndex, not attached to a
+     *        container.
+     *
+     */
+    XsortedIndex() = default;
+
+    /**
+     * @brief Construct a new XsortedIndex over a sorted container.
+     *
+     * @param container Container to index, sorted in byte order.
+     */
+    explicit XsortedIndex(const Container &container);
+
+    /**
+     * @brief Replaces the index with one over a sorted container. Throws
+     *        std::length_error if it holds more than 2^32 - 1 strings.
+     *
+     * @param container Container to index, sorted in byte order.
+     */
+    void build(const Container &container);
+
+    /**
+     * @brief Returns the rank of the first string not less than key.
+     *
+     * @param key String to look for.
+     * @return size_t rank, or size() if every string is less.
+     */
+    size_t lower_bound(string_view key) const;
+
+    /**
+     * @brief Returns the rank of the first string greater than key.
+     *
+     * @param key String to look for.
+     * @return size_t rank, or size() if no string is greater.
+     */
+    size_t upper_bound(string_view key) const;
+
+    /**
+     * @brief Returns the ranks of the strings equal to key, as
+     *        [first, second).
+     *
+     * @param key String to look for.
+     * @return pair<size_t, size_t>
+     */
+    pair<size_t, size_t> equal_range(string_view key) const;
+
+    /**
+     * @brief Returns the ranks of the strings that start with prefix, as
+     *        [first, second). An empty prefix matches every string.
+     *
+     * @param prefix Prefix to look for.
+     * @return pair<size_t, size_t>
+     */
+    pair<size_t, size_t> prefix_range(string_view prefix) const;
+
+    /**
+     * @brief Tests if a string is in the container.
+     *
+     * @param key String to look for.
+     * @return true if found, false otherwise.
+     */
+    bool contains(string_view key) const;
+
+    /**
+     * @brief Returns the number of strings indexed.
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Tests if the index is empty.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the bytes used by the index, excluding the strings.
+     *
+     * @return size_t
+     */
+    size_t memory_bytes() const;
+};
+
+template <typename Container>
+inline const uint64_t *XsortedIndex<Container>::keys() const
+{
+    return key_storage.begin() + key_offset;
+}
+
+template <typename Container>
+void XsortedIndex<Container>::fill(size_t k, size_t &next)
+{
+    if (k > count)
+        return;
+    fill(2 * k, next);
+    key_storage[key_offset + k] = xsorted_key((*words)[next]);
+    ranks[k] = static_cast<uint32_t>(next++);
+    fill(2 * k + 1, next);
+}
+
+template <typename Container>
+inline size_t XsortedIndex<Container>::key_lower_bound(uint64_t key, bool &tie) const
+{
+    const uint64_t *t = keys();
+    size_t k = 1;
+    if (count >= prefetch_min)
+        while (k <= count)
+        {
+            XSORTED_PREFETCH(t + min(8 * k, count)); // 8 keys per line: nodes 8k..8k+7 are three levels down
+            k = 2 * k + (t[k] < key);
+        }
+    else
+        while (k <= count)
+            k = 2 * k + (t[k] < key);
+    k >>= xsorted_trailing_ones(k) + 1; // Undo the right turns taken after the last left turn
+    if (!k)
+    {
+        tie = false;
+        return count;
+    }
+    tie = t[k] == key;
+    return ranks[k];
+}
+
+template <typename Container>
+template <typename Less>
+inline size_t XsortedIndex<Container>::gallop(size_t pos, Less less) const
+{
+    size_t lo = pos; // Every rank before lo is known to be less
+    size_t step = 1;
+    while (pos < count && less(string_view((*words)[pos])))
+    {
+        lo = pos + 1;
+        pos += step;
+        step *= 2;
+    }
+    size_t hi = pos < count ? pos : count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (less(string_view((*words)[mid])))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+template <typename Container>
+XsortedIndex<Container>::XsortedIndex(const Container &container)
+{
+    build(container);
+}
+
+template <typename Container>
+void XsortedIndex<Container>::build(const Container &container)
+{
+    if (container.size() > UINT32_MAX)
+        throw length_error("XsortedIndex::build: more strings than 32-bit ranks can hold");
+    words = &container;
+    count = container.size();
+    key_storage.assign(count + 1 + 7, 0); // Node 0 is unused; 7 spare keys to align node 0
+    uintptr_t address = reinterpret_cast<uintptr_t>(key_storage.begin());
+    key_offset = ((64 - address % 64) % 64) / sizeof(uint64_t);
+    ranks.resize_for_overwrite(count + 1);
+    size_t next = 0;
+    fill(1, next);
+}
+
+template <typename Container>
+size_t XsortedIndex<Container>::lower_bound(string_view key) const
+{
+    bool tie;
+    size_t pos = key_lower_bound(xsorted_key(key), tie);
+    if (!tie || (key.size() < 8 && (key.empty() || key.back() != '\0'))) // Then the tied string starts with key
+        return pos;
+    return gallop(pos, [key](string_view s) { return s < key; });
+}
+
+template <typename Container>
+size_t XsortedIndex<Container>::upper_bound(string_view key) const
+{
+    bool tie;
+    size_t pos = key_lower_bound(xsorted_key(key), tie);
+    if (!tie)
+        return pos;
+    return gallop(pos, [key](string_view s) { return s <= key; });
+}
+
+template <typename Container>
+pair<size_t, size_t> XsortedIndex<Container>::equal_range(string_view key) const
+{
+    size_t first = lower_bound(key);
+    size_t last = first;
+    if (first < count && string_view((*words)[first]) == key)
+        last = gallop(first + 1, [key](string_view s) { return s == key; }); // Equal strings are all at the front
+    return {first, last};
+}
+
+template <typename Container>
+pair<size_t, size_t> XsortedIndex<Container>::prefix_range(string_view prefix) const
+{
+    size_t first = lower_bound(prefix);
+    string next(prefix); // Smallest string above every string starting with prefix
+    while (!next.empty() && static_cast<unsigned char>(next.back()) == 0xFF)
+        next.pop_back();
+    if (next.empty())
+        return {first, count};
+    next.back() = static_cast<char>(static_cast<unsigned char>(next.back()) + 1);
+    return {first, lower_bound(next)};
+}
+
+template <typename Container>
+inline bool XsortedIndex<Container>::contains(string_view key) const
+{
+    size_t pos = lower_bound(key);
+    return pos < count && string_view((*words)[pos]) == key;
+}
+
+template <typename Container>
+inline size_t XsortedIndex<Container>::size() const
+{
+    return count;
+}
+
+template <typename Container>
+inline bool XsortedIndex<Container>::empty() const
+{
+    return !count;
+}
+
+template <typename Container>
+inline size_t XsortedIndex<Container>::memory_bytes() const
+{
+    return key_storage.capacity() * sizeof(uint64_t) + ranks.capacity() * sizeof(uint32_t);
+}
@@ -0,0 +1,304 @@
+/**
+ * @file XstringVector.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief A vector of strings stored back to back in one byte buffer. Each
+ *        string is an (offset, length) entry into the buffer and is accessed
+ *        as a string_view, so a word list costs its characters plus one small
+ *        entry per word, and a scan over all words reads memory in order.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>     // for size_t, ptrdiff_t
+#include <cstdint>     // for uint32_t
+#include <iterator>    // for random_access_iterator_tag
+#include <limits>      // for numeric_limits
+#include <stdexcept>   // for basic exceptions
+#include <string_view> // for string_view
+#include "Xvector.hpp"
+using namespace std;
+
+/**
+ * @brief A container of strings backed by a single growable byte buffer.
+ *        Strings are appended and read back as string_views; a string_view is
+ *        invalidated when the buffer grows, like an Xvector iterator.
+ *
+ * @tparam Index unsigned type of offsets and lengths, default is uint32_t
+ *         (up to 4 GiB of text). Use size_t for larger lists.
+ */
+template <typename Index = uint32_t>
+class XstringVector
+{
+public:
+    /**
+     * @brief Position and length of one string in the byte buffer.
+     *
+     */
+    struct entry
+    {
+        Index offset;
+        Index length;
+    };
+
+private:
+    Xvector<char> bytes;    // Characters of every string, back to back
+    Xvector<entry> entries; // One entry per string
+
+public:
+    /**
+     * @brief Random access iterator yielding each string as a string_view.
+     *
+     */
+    class const_iterator
+    {
+    private:
+        const XstringVector *pool{nullptr};
+        size_t pos{0};
+
+    public:
+        using iterator_category = random_access_iterator_tag;
+        using value_type = string_view;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = string_view;
+
+        const_iterator() {}
+        const_iterator(const XstringVector *_pool, size_t _pos) : pool(_pool), pos(_pos) {}
+
+        string_view operator*() const { return (*pool)[pos]; }
+        string_view operator[](difference_type n) const { return (*pool)[pos + n]; }
+
+        const_iterator &operator++() { pos++; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; pos++; return tmp; }
+        const_iterator &operator--() { pos--; return *this; }
+        const_iterator operator--(int) { const_iterator tmp = *this; pos--; return tmp; }
+        const_iterator &operator+=(difference_type n) { pos += n; return *this; }
+        const_iterator &operator-=(difference_type n) { pos -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(pool, pos + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(pool, pos - n); }
+        difference_type operator-(const const_iterator &other) const { return difference_type(pos) - difference_type(other.pos); }
+
+        bool operator==(const const_iterator &other) const { return pos == other.pos; }
+        bool operator!=(const const_iterator &other) const { return pos != other.pos; }
+        bool operator<(const const_iterator &other) const { return pos < other.pos; }
+        bool operator>(const const_iterator &other) const { return pos > other.pos; }
+        bool operator<=(const const_iterator &other) const { return pos <= other.pos; }
+        bool operator>=(const const_iterator &other) const { return pos >= other.pos; }
+    };
+
+    using iterator = const_iterator;
+
+    /**
+     * @brief Tests if the pool holds no strings.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of strings.
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the total number of characters in all strings.
+     *
+     * @return size_t
+     */
+    size_t bytes_size() const;
+
+    /**
+     * @brief Returns the number of bytes of memory held by the pool,
+     *        including unused capacity.
+     *
+     * @return size_t
+     */
+    size_t memory_usage() const;
+
+    /**
+     * @brief Reserves room for a number of strings and characters, so a
+     *        loader that knows its totals never reallocates.
+     *
+     * @param count Number of strings.
+     * @param total_bytes Number of characters in all strings.
+     */
+    void reserve(size_t count, size_t total_bytes);
+
+    /**
+     * @brief Releases unused capacity of the buffer and the entry table.
+     *
+     */
+    void shrink_to_fit();
+
+    /**
+     * @brief Appends a copy of a string to the end of the pool. Throws
+     *        std::length_error if the pool would pass the largest offset
+     *        Index can hold.
+     *
+     * @param s The string to be appended.
+     */
+    void push_back(string_view s);
+
+    /**
+     * @brief Removes the last string.
+     *
+     */
+    void pop_back();
+
+    /**
+     * @brief Removes every string.
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Returns a view of the string at the given index.
+     *
+     * @param pos Index of the string.
+     * @return string_view
+     */
+    string_view operator[](size_t pos) const;
+
+    /**
+     * @brief Returns a view of the string at the given index. Throws
+     *        std::out_of_range if the index is not within the pool.
+     *
+     * @param pos Index of the string.
+     * @return string_view
+     */
+    string_view at(size_t pos) const;
+
+    /**
+     * @brief Returns a view of the last string.
+     *
+     * @return string_view
+     */
+    string_view back() const;
+
+    /**
+     * @brief Returns the entry table, for code that walks offsets directly.
+     *
+     * @return const Xvector<entry>&
+     */
+    const Xvector<entry> &index() const;
+
+    /**
+     * @brief Returns a pointer to the first character of the buffer.
+     *
+     * @return const char*
+     */
+    const char *buffer() const;
+
+    /**
+     * @brief Returns an iterator to the first string in the pool.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns an iterator to the string one past the last string in
+     *        the pool.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const;
+};
+
+template <typename Index>
+inline bool XstringVector<Index>::empty() const { return entries.empty(); }
+
+template <typename Index>
+inline size_t XstringVector<Index>::size() const { return entries.size(); }
+
+template <typename Index>
+inline size_t XstringVector<Index>::bytes_size() const { return bytes.size(); }
+
+template <typename Index>
+inline size_t XstringVector<Index>::memory_usage() const
+{
+    return bytes.capacity() + entries.capacity() * sizeof(entry);
+}
+
+template <typename Index>
+inline void XstringVector<Index>::reserve(size_t count, size_t total_bytes)
+{
+    entries.reserve(count);
+    bytes.reserve(total_bytes);
+}
+
+template <typename Index>
+inline void XstringVector<Index>::shrink_to_fit()
+{
+    entries.shrink_to_fit();
+    bytes.shrink_to_fit();
+}
+
+template <typename Index>
+inline void XstringVector<Index>::push_back(string_view s)
+{
+    if (s.size() > static_cast<size_t>(numeric_limits<Index>::max()) - bytes.size())
+        throw length_error("XstringVector::push_back: total bytes exceed what Index can hold");
+    entry e{static_cast<Index>(bytes.size()), static_cast<Index>(s.size())};
+    bytes.insert(bytes.end(), s.begin(), s.end());
+    entries.push_back(e);
+}
+
+template <typename Index>
+inline void XstringVector<Index>::pop_back()
+{
+    if (empty())
+        return;
+    bytes.resize(entries[entries.size() - 1].offset);
+    entries.pop_back();
+}
+
+template <typename Index>
+inline void XstringVector<Index>::clear()
+{
+    bytes.clear();
+    entries.clear();
+}
+
+template <typename Index>
+inline string_view XstringVector<Index>::operator[](size_t pos) const
+{
+    const entry &e = entries[pos];
+    return string_view(bytes.begin() + e.offset, e.length);
+}
+
+template <typename Index>
+inline string_view XstringVector<Index>::at(size_t pos) const
+{
+    if (pos >= size())
+        throw out_of_range("XstringVector::at: index out of range");
+    return (*this)[pos];
+}
+
+template <typename Index>
+inline string_view XstringVector<Index>::back() const { return (*this)[size() - 1]; }
+
+template <typename Index>
+inline const Xvector<typename XstringVector<Index>::entry> &XstringVector<Index>::index() const { return entries; }
+
+template <typename Index>
+inline const char *XstringVector<Index>::buffer() const { return bytes.begin(); }
+
+template <typename Index>
+inline typename XstringVector<Index>::const_iterator XstringVector<Index>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template <typename Index>
+inline typename XstringVector<Index>::const_iterator XstringVector<Index>::end() const
+{
+    return const_iterator(this, size());
+}
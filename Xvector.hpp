@@ -9,11 +9,387 @@
  *
  */
 
-#include <cstddef>   // for size_t
-#include <stdexcept> // for basic exceptions
-#include <memory>    // for allocators
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <algorithm>   // for move, move_backward, find_if
+#include <atomic>      // for atomic counters
+#include <cstdio>      // for FILE, fprintf
+#include <cstdlib>     // for free
+#include <cstring>     // for memcpy, memmove
+#include <iterator>    // for iterator_traits, distance
+#include <stdexcept>   // for basic exceptions
+#include <memory>      // for allocators
+#include <type_traits> // for type traits
+#include <typeinfo>    // for typeid
+#include <string>      // for string
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h> // for __cxa_demangle
+#endif
+#include <utility>     // for move, forward
 using namespace std;
 
+/**
+ * @brief Tells Xvector whether objects of type T can be relocated to a new
+ *        address with a plain memcpy, skipping the move constructor and the
+ *        destructor of the old object. Defaults to trivially copyable types;
+ *        specialize for types that hold no pointers into themselves.
+ *
+ * @tparam T type of element.
+ */
+template <typename T>
+struct xvector_trivially_relocatable : is_trivially_copyable<T>
+{
+};
+
+/**
+ * @brief Returns the base-2 logarithm of a number, rounded down, at compile
+ *        time, e.g. the shift for a power-of-two template parameter.
+ *
+ * @param n Number, at least 1.
+ * @return size_t
+ */
+constexpr size_t xvector_log2(size_t n)
+{
+    size_t bits = 0;
+    while (n >>= 1)
+        bits++;
+    return bits;
+}
+
+/**
+ * @brief Returns the position of the highest set bit of a number, with one
+ *        instruction where the compiler offers it.
+ *
+ * @param n Number, at least 1.
+ * @return size_t
+ */
+inline size_t xvector_high_bit(size_t n)
+{
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll(n);
+#else
+    return xvector_log2(n);
+#endif
+}
+
+/**
+ * @brief Returns the position of the lowest set bit of a number, with one
+ *        instruction where the compiler offers it.
+ *
+ * @param n Number, at least 1.
+ * @return size_t
+ */
+inline size_t xvector_low_bit(size_t n)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(n);
+#else
+    size_t bits = 0;
+    for (; !(n & 1); n >>= 1)
+        bits++;
+    return bits;
+#endif
+}
+
+/**
+ * @brief Growth policy that doubles the capacity of a full Xvector. Fewest
+ *        reallocations, but a freed block is never large enough to be reused
+ *        by a later growth step.
+ *
+ */
+struct xvector_growth_double
+{
+    /**
+     * @brief Returns the capacity to grow to.
+     *
+     * @param capacity Current capacity.
+     * @param required Minimum capacity needed.
+     * @param elem_size Size of one element in bytes.
+     * @return size_t
+     */
+    static size_t grow(size_t capacity, size_t required, size_t elem_size)
+    {
+        (void)elem_size;
+        size_t next = capacity ? capacity * 2 : 1;
+        return next < required ? required : next;
+    }
+};
+
+/**
+ * @brief Growth policy that multiplies the capacity of a full Xvector by 1.5.
+ *        Since 1.5 is below the golden ratio, the blocks freed by earlier
+ *        growth steps eventually add up to the next request, so the allocator
+ *        can hand that memory back instead of always extending the heap.
+ *
+ */
+struct xvector_growth_half
+{
+    /**
+     * @brief Returns the capacity to grow to.
+     *
+     * @param capacity Current capacity.
+     * @param required Minimum capacity needed.
+     * @param elem_size Size of one element in bytes.
+     * @return size_t
+     */
+    static size_t grow(size_t capacity, size_t required, size_t elem_size)
+    {
+        (void)elem_size;
+        size_t next = capacity + capacity / 2;
+        if (next <= capacity)
+            next = capacity + 1;
+        return next < required ? required : next;
+    }
+};
+
+/**
+ * @brief Growth policy that doubles the capacity and then rounds the block up
+ *        to the allocator's granularity: a multiple of PageSize for large
+ *        blocks, a multiple of SizeClass for small ones. The slack the
+ *        allocator would hand out anyway becomes usable capacity.
+ *
+ * @tparam PageSize size of a page in bytes, default is 4096.
+ * @tparam SizeClass granularity of small allocations in bytes, default is 16.
+ */
+template <size_t PageSize = 4096, size_t SizeClass = 16>
+struct xvector_growth_page_rounded
+{
+    /**
+     * @brief Returns the capacity to grow to.
+     *
+     * @param capacity Current capacity.
+     * @param required Minimum capacity needed.
+     * @param elem_size Size of one element in bytes.
+     * @return size_t
+     */
+    static size_t grow(size_t capacity, size_t required, size_t elem_size)
+    {
+        size_t next = xvector_growth_double::grow(capacity, required, elem_size);
+        size_t bytes = next * elem_size;
+        size_t unit = bytes < PageSize ? SizeClass : PageSize;
+        bytes = (bytes + unit - 1) / unit * unit;
+        return bytes / elem_size;
+    }
+};
+
+/**
+ * @brief Instrumentation policy that records nothing. Every hook is an empty
+ *        inline function, so an Xvector using it compiles to the same code as
+ *        one without hooks.
+ *
+ */
+struct xvector_no_tracking
+{
+    template <typename T>
+    static void on_allocate(size_t bytes) { (void)bytes; }
+
+    template <typename T>
+    static void on_deallocate(size_t bytes) { (void)bytes; }
+
+    template <typename T>
+    static void on_relocate(size_t count, size_t bytes, bool copied) { (void)count, (void)bytes, (void)copied; }
+
+    template <typename T>
+    static void on_release(size_t size, size_t capacity) { (void)size, (void)capacity; }
+};
+
+/**
+ * @brief Counters kept by xvector_tracking for one element type at one call
+ *        site. Updated with relaxed atomics, so Xvectors on several threads
+ *        may share them.
+ *
+ */
+struct xvector_stats
+{
+    const char *type{nullptr}; // Mangled name of the element type
+    const char *site{nullptr}; // Mangled name of the call-site tag
+    size_t elem_size{0};       // sizeof the element type
+    atomic<size_t> allocations{0};
+    atomic<size_t> deallocations{0};
+    atomic<size_t> bytes_allocated{0};
+    atomic<size_t> bytes_deallocated{0};
+    atomic<size_t> relocated_moves{0};  // Elements moved (or memcpy'd) by growth
+    atomic<size_t> relocated_copies{0}; // Elements copied by growth, T has a throwing move
+    atomic<size_t> bytes_relocated{0};  // Bytes moved by growth
+    atomic<size_t> peak_capacity{0};    // Largest capacity seen
+    atomic<size_t> peak_size{0};        // Largest size seen when an array was released
+    atomic<size_t> unused_bytes{0};     // Capacity minus size, summed over released arrays
+    xvector_stats *next{nullptr};       // Next registered entry
+
+    /**
+     * @brief Raises a peak counter to at least the given value.
+     *
+     * @param peak Counter to raise.
+     * @param value Observed value.
+     */
+    static void raise(atomic<size_t> &peak, size_t value)
+    {
+        size_t seen = peak.load(memory_order_relaxed);
+        while (seen < value && !peak.compare_exchange_weak(seen, value, memory_order_relaxed))
+        {
+        }
+    }
+};
+
+/**
+ * @brief Returns the head of the list of every xvector_stats entry created so
+ *        far.
+ *
+ * @return atomic<xvector_stats *>&
+ */
+inline atomic<xvector_stats *> &xvector_stats_registry()
+{
+    static atomic<xvector_stats *> head{nullptr};
+    return head;
+}
+
+/**
+ * @brief Instrumentation policy that counts allocations, deallocations,
+ *        elements relocated by growth, peak capacity and unused capacity.
+ *        Counters are kept per element type and per Site, a tag type that
+ *        tells call sites apart, e.g. struct dictionary_load. Print them with
+ *        xvector_tracking_report().
+ *
+ * @tparam Site tag type naming the call site, default is void (per type only).
+ */
+template <typename Site = void>
+struct xvector_tracking
+{
+    /**
+     * @brief Returns the counters for element type T at this call site.
+     *
+     * @tparam T type of element.
+     * @return xvector_stats&
+     */
+    template <typename T>
+    static xvector_stats &stats()
+    {
+        static xvector_stats *entry = []
+        {
+            xvector_stats *e = new xvector_stats; // Never freed: reported at exit
+            e->type = typeid(T).name();
+            e->site = typeid(Site).name();
+            e->elem_size = sizeof(T);
+            atomic<xvector_stats *> &head = xvector_stats_registry();
+            e->next = head.load();
+            while (!head.compare_exchange_weak(e->next, e))
+            {
+            }
+            return e;
+        }();
+        return *entry;
+    }
+
+    template <typename T>
+    static void on_allocate(size_t bytes)
+    {
+        xvector_stats &s = stats<T>();
+        s.allocations.fetch_add(1, memory_order_relaxed);
+        s.bytes_allocated.fetch_add(bytes, memory_order_relaxed);
+        xvector_stats::raise(s.peak_capacity, bytes / sizeof(T));
+    }
+
+    template <typename T>
+    static void on_deallocate(size_t bytes)
+    {
+        xvector_stats &s = stats<T>();
+        s.deallocations.fetch_add(1, memory_order_relaxed);
+        s.bytes_deallocated.fetch_add(bytes, memory_order_relaxed);
+    }
+
+    template <typename T>
+    static void on_relocate(size_t count, size_t bytes, bool copied)
+    {
+        xvector_stats &s = stats<T>();
+        (copied ? s.relocated_copies : s.relocated_moves).fetch_add(count, memory_order_relaxed);
+        s.bytes_relocated.fetch_add(bytes, memory_order_relaxed);
+    }
+
+    template <typename T>
+    static void on_release(size_t size, size_t capacity)
+    {
+        xvector_stats &s = stats<T>();
+        xvector_stats::raise(s.peak_size, size);
+        s.unused_bytes.fetch_add((capacity - size) * sizeof(T), memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Returns a readable name for a mangled type name where the compiler
+ *        provides a demangler, the name itself otherwise.
+ *
+ * @param mangled Name from typeid.
+ * @return string
+ */
+inline string xvector_type_name(const char *mangled)
+{
+#if __has_include(<cxxabi.h>)
+    int status = 0;
+    char *readable = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    if (status == 0 && readable)
+    {
+        string name(readable);
+        free(readable);
+        return name;
+    }
+#endif
+    return mangled;
+}
+
+/**
+ * @brief Prints one line per element type and call site tracked so far.
+ *
+ * @param out Stream to print to.
+ */
+inline void xvector_tracking_report(FILE *out)
+{
+    for (xvector_stats *s = xvector_stats_registry().load(); s; s = s->next)
+        fprintf(out,
+                "Xvector<%s> site %s: %zu allocs (%zu bytes), %zu frees (%zu bytes), "
+                "growth moved %zu and copied %zu elements (%zu bytes), "
+                "peak capacity %zu vs peak size %zu, %zu bytes unused at release\n",
+                xvector_type_name(s->type).c_str(), xvector_type_name(s->site).c_str(), s->allocations.load(), s->bytes_allocated.load(), s->deallocations.load(),
+                s->bytes_deallocated.load(), s->relocated_moves.load(), s->relocated_copies.load(),
+                s->bytes_relocated.load(), s->peak_capacity.load(), s->peak_size.load(), s->unused_bytes.load());
+}
+
+/**
+ * @brief Uninitialized storage for the first N elements of an Xvector, laid
+ *        out like Xarray's T arr[sz] but without constructing anything. The
+ *        elements are constructed and destroyed by the owning Xvector.
+ *
+ * @tparam T type of element.
+ * @tparam N number of elements stored inline.
+ */
+template <typename T, size_t N>
+struct xvector_inline_storage
+{
+    union
+    {
+        T arr[N];
+    };
+
+    xvector_inline_storage() {}
+    xvector_inline_storage(const xvector_inline_storage &) = delete;
+    xvector_inline_storage &operator=(const xvector_inline_storage &) = delete;
+    ~xvector_inline_storage() {}
+
+    T *inline_data() { return arr; }
+};
+
+/**
+ * @brief No inline storage: an Xvector with InlineCap 0 keeps every element
+ *        on the heap and pays nothing for this base.
+ *
+ * @tparam T type of element.
+ */
+template <typename T>
+struct xvector_inline_storage<T, 0>
+{
+    T *inline_data() { return nullptr; }
+};
+
 /**
  * @brief A container that allows constant time access to any element in the
  *        container. Dynamically resizes as needed so the user does not need
@@ -21,9 +397,16 @@ using namespace std;
  *
  * @tparam T type of element.
  * @tparam Alloc type of allocator, default is std::allocator<T>
+ * @tparam Growth growth policy used when the vector is full, default is
+ *         xvector_growth_double
+ * @tparam InlineCap number of elements stored inside the object itself before
+ *         spilling to the heap, default is 0. See SmallXvector.
+ * @tparam Track instrumentation policy, default is xvector_no_tracking. See
+ *         TrackedXvector.
  */
-template <typename T, typename Alloc = std::allocator<T>>
-class Xvector
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = xvector_growth_double, size_t InlineCap = 0,
+          typename Track = xvector_no_tracking>
+class Xvector : private xvector_inline_storage<T, InlineCap>
 {
 private:
     Alloc alloc;                // Allocator for array
@@ -31,13 +414,155 @@ private:
     size_t xvector_size{0};     // Number of elements in array
     size_t xvector_capacity{0}; // Number of elements array can hold before resizing.
 
+    using alloc_traits = allocator_traits<Alloc>;
+
     /**
      * @brief Destroys each element in the array.
      *
      * @param _data Pointer to array.
-     * @param _capacity Size of the array.
+     * @param _size Number of constructed elements in the array.
+     */
+    void destroy_elems(T *_data, size_t _size);
+
+    /**
+     * @brief Allocates an array for the given number of elements.
+     *
+     * @param _capacity Number of elements.
+     * @return T* pointer to the uninitialized array.
+     */
+    T *allocate_block(size_t _capacity);
+
+    /**
+     * @brief Returns an array to the allocator, unless it is the inline
+     *        buffer.
+     *
+     * @param _data Pointer to array, may be null.
+     * @param _capacity Capacity the array was allocated with.
+     */
+    void release(T *_data, size_t _capacity);
+
+    /**
+     * @brief Moves elements from one array into uninitialized storage without
+     *        destroying the originals. Uses memcpy for trivially relocatable
+     *        types and std::move_if_noexcept otherwise, so a throwing copy
+     *        leaves the source untouched.
+     *
+     * @param _src Pointer to the elements to be moved.
+     * @param _size Number of elements to move.
+     * @param _dest Pointer to uninitialized storage for the elements.
+     */
+    void move_into(T *_src, size_t _size, T *_dest);
+
+    /**
+     * @brief Moves elements from one array into uninitialized storage and
+     *        ends the lifetime of the originals.
+     *
+     * @param _src Pointer to the elements to be relocated.
+     * @param _size Number of elements to relocate.
+     * @param _dest Pointer to uninitialized storage for the elements.
+     */
+    void relocate(T *_src, size_t _size, T *_dest);
+
+    /**
+     * @brief Returns the capacity to grow to when the array is full, as
+     *        chosen by the growth policy.
+     *
+     * @param required Minimum capacity needed.
+     * @return size_t
+     */
+    size_t next_capacity(size_t required) const;
+
+    /**
+     * @brief Moves the elements into a newly allocated array of the given
+     *        capacity. Strong exception guarantee.
+     *
+     * @param new_capacity Capacity of the new array, at least size().
+     */
+    void reallocate(size_t new_capacity);
+
+    /**
+     * @brief Grows the array and constructs a new element at the given index.
+     *        The new element is built before the old ones are relocated, so
+     *        arguments referring into the vector stay valid. Strong exception
+     *        guarantee.
+     *
+     * @tparam Args types of the constructor arguments.
+     * @param pos Index of the new element, at most size().
+     * @param args Arguments forwarded to the constructor of T.
+     */
+    template <typename... Args>
+    void grow_and_insert(size_t pos, Args &&...args);
+
+    /**
+     * @brief Yields the same value a given number of times, so the fill
+     *        overloads can share the range code below.
+     *
+     */
+    struct fill_iterator
+    {
+        const T *value;
+
+        const T &operator*() const { return *value; }
+        fill_iterator &operator++() { return *this; }
+    };
+
+    /**
+     * @brief True if a range of It can be copied into the array with memcpy:
+     *        It is a pointer to T and T is trivially copyable.
+     *
+     * @tparam It type of iterator.
+     */
+    template <typename It>
+    static constexpr bool bulk_copyable = is_trivially_copyable<T>::value && is_pointer<It>::value &&
+                                          is_same<remove_cv_t<remove_pointer_t<It>>, T>::value;
+
+    /**
+     * @brief Copy-constructs n elements from a range into uninitialized
+     *        storage, with one memcpy when the range is bulk_copyable. If a
+     *        constructor throws, the elements already built are destroyed.
+     *
+     * @tparam ForwardIt type of iterator, only needs * and prefix ++.
+     * @param dest Pointer to uninitialized storage for n elements.
+     * @param n Number of elements.
+     * @param first Iterator to the first element to copy.
+     */
+    template <typename ForwardIt>
+    void construct_n(T *dest, size_t n, ForwardIt first);
+
+    /**
+     * @brief Inserts n elements copied from a range before the given index.
+     *        The tail is shifted exactly once: with one memmove for trivially
+     *        relocatable types, by move-assignment otherwise. Reallocates at
+     *        most once.
+     *
+     * @tparam ForwardIt type of iterator, only needs * and prefix ++.
+     * @param index Index before which the elements are inserted.
+     * @param n Number of elements to insert.
+     * @param first Iterator to the first element to copy.
      */
-    void destroy_elems(T *_data, size_t _capacity) const;
+    template <typename ForwardIt>
+    void insert_n(size_t index, size_t n, ForwardIt first);
+
+    /**
+     * @brief Replaces the contents with n elements copied from a range.
+     *        Reallocates only if n exceeds the capacity.
+     *
+     * @tparam ForwardIt type of iterator, only needs * and prefix ++.
+     * @param n Number of elements.
+     * @param first Iterator to the first element to copy.
+     */
+    template <typename ForwardIt>
+    void assign_n(size_t n, ForwardIt first);
+
+    /**
+     * @brief Takes over the elements of another vector, which is left empty.
+     *        A heap array is adopted as is; elements in the other vector's
+     *        inline buffer are relocated into this one's. This vector must be
+     *        empty and hold no array.
+     *
+     * @param other Vector to take the elements from.
+     */
+    void steal(Xvector &other);
 
 public:
     using iterator = T *;
@@ -50,6 +575,74 @@ public:
      */
     Xvector();
 
+    /**
+     * @brief Construct a new Xvector object that allocates through a copy of
+     *        the given allocator, e.g. one bound to an Xarena.
+     *
+     * @param a Allocator to be copied.
+     */
+    explicit Xvector(const Alloc &a);
+
+    /**
+     * @brief Construct a new Xvector object holding copies of the elements in
+     *        [first, last). Forward ranges are measured first and allocated
+     *        exactly once.
+     *
+     * @tparam InputIt type of iterator.
+     * @param first Iterator to the first element to copy.
+     * @param last Iterator one past the last element to copy.
+     * @param a Allocator to be copied.
+     */
+    template <typename InputIt, typename = typename iterator_traits<InputIt>::iterator_category>
+    Xvector(InputIt first, InputIt last, const Alloc &a = Alloc());
+
+    /**
+     * @brief Construct a new Xvector object holding a copy of every element
+     *        of another. Allocates exactly other.size() elements, and copies
+     *        trivially copyable types with one memcpy.
+     *
+     * @param other Vector to be copied.
+     */
+    Xvector(const Xvector &other);
+
+    /**
+     * @brief Construct a new Xvector object by taking over the array of
+     *        another, which is left empty. Constant time unless the elements
+     *        sit in the other vector's inline buffer.
+     *
+     * @param other Vector to be moved from.
+     */
+    Xvector(Xvector &&other) noexcept(InlineCap == 0 || is_nothrow_move_constructible<T>::value);
+
+    /**
+     * @brief Replaces the contents with a copy of another vector's. Reuses
+     *        the current array when it is large enough.
+     *
+     * @param other Vector to be copied.
+     * @return Xvector&
+     */
+    Xvector &operator=(const Xvector &other);
+
+    /**
+     * @brief Replaces the contents with those of another vector, which is
+     *        left empty. Takes over the other array when the allocators allow
+     *        it, and moves element by element otherwise.
+     *
+     * @param other Vector to be moved from.
+     * @return Xvector&
+     */
+    Xvector &operator=(Xvector &&other) noexcept((InlineCap == 0 || is_nothrow_move_constructible<T>::value) &&
+                                                 (allocator_traits<Alloc>::propagate_on_container_move_assignment::value ||
+                                                  allocator_traits<Alloc>::is_always_equal::value));
+
+    /**
+     * @brief Exchanges the contents of two vectors. Swaps the arrays in
+     *        constant time when neither uses an inline buffer.
+     *
+     * @param other Vector to swap with.
+     */
+    void swap(Xvector &other);
+
     /**
      * @brief Destroy the Xvector object.
      *
@@ -115,6 +708,23 @@ public:
      */
     size_t capacity() const;
 
+    /**
+     * @brief Increases the capacity of the vector to at least the given
+     *        number of elements. Does nothing if the capacity is already large
+     *        enough.
+     *
+     * @param new_capacity Minimum capacity of the vector.
+     */
+    void reserve(size_t new_capacity);
+
+    /**
+     * @brief Reduces the capacity of the vector to its size, releasing the
+     *        unused memory. Moves the elements back into the inline buffer if
+     *        they fit.
+     *
+     */
+    void shrink_to_fit();
+
     /**
      * @brief Inserts an element at the end of the vector.
      *
@@ -129,6 +739,28 @@ public:
      */
     void push_back(const T &x);
 
+    /**
+     * @brief Constructs an element in place at the end of the vector.
+     *
+     * @tparam Args types of the constructor arguments.
+     * @param args Arguments forwarded to the constructor of T.
+     * @return T& reference to the new element.
+     */
+    template <typename... Args>
+    T &emplace_back(Args &&...args);
+
+    /**
+     * @brief Constructs an element in place before the given position,
+     *        shifting the following elements back by one.
+     *
+     * @tparam Args types of the constructor arguments.
+     * @param pos Position before which the element is constructed.
+     * @param args Arguments forwarded to the constructor of T.
+     * @return iterator to the new element.
+     */
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
+
     /**
      * @brief Decreases the size of the vector by 1.
      *
@@ -142,342 +774,899 @@ public:
     void clear();
 
     /**
-     * @brief Erases an element at a given position
-     *  !!! NEEDS REWORKING & ITERATOR FUNCTIONALITY !!!
+     * @brief Erases the element at the given position.
+     *
+     * @param pos Position of the element to erase.
+     * @return iterator following the erased element.
+     */
+    iterator erase(const_iterator pos);
+
+    /**
+     * @brief Erases the elements in [first, last), shifting the tail forward
+     *        once.
      *
-     * @param pos
+     * @param first Position of the first element to erase.
+     * @param last Position one past the last element to erase.
+     * @return iterator following the erased elements.
      */
-    void erase(size_t pos);
+    iterator erase(const_iterator first, const_iterator last);
+
+    /**
+     * @brief Appends copies of the elements in [first, last) to the end of
+     *        the vector. Forward ranges are measured first, so the vector
+     *        grows at most once and pointer ranges of trivially copyable types
+     *        are copied with one memcpy. The range must not point into this
+     *        vector.
+     *
+     * @tparam InputIt type of iterator.
+     * @param first Iterator to the first element to append.
+     * @param last Iterator one past the last element to append.
+     */
+    template <typename InputIt, typename = typename iterator_traits<InputIt>::iterator_category>
+    void append_range(InputIt first, InputIt last);
+
+    /**
+     * @brief Appends copies of a contiguous array of elements to the end of
+     *        the vector, e.g. another vector's begin() and size().
+     *
+     * @param first Pointer to the first element to append.
+     * @param count Number of elements.
+     */
+    void append(const T *first, size_t count);
+
+    /**
+     * @brief Inserts n copies of a value before the given position.
+     *
+     * @param pos Position before which the elements are inserted.
+     * @param n Number of copies.
+     * @param x Value to be inserted.
+     * @return iterator to the first inserted element.
+     */
+    iterator insert(const_iterator pos, size_t n, const T &x);
+
+    /**
+     * @brief Inserts copies of the elements in [first, last) before the given
+     *        position. The range must not point into this vector.
+     *
+     * @tparam InputIt type of iterator.
+     * @param pos Position before which the elements are inserted.
+     * @param first Iterator to the first element to insert.
+     * @param last Iterator one past the last element to insert.
+     * @return iterator to the first inserted element.
+     */
+    template <typename InputIt, typename = typename iterator_traits<InputIt>::iterator_category>
+    iterator insert(const_iterator pos, InputIt first, InputIt last);
+
+    /**
+     * @brief Replaces the contents with n copies of a value.
+     *
+     * @param n Number of copies.
+     * @param x Value to be assigned.
+     */
+    void assign(size_t n, const T &x);
+
+    /**
+     * @brief Replaces the contents with copies of the elements in
+     *        [first, last). The range must not point into this vector.
+     *
+     * @tparam InputIt type of iterator.
+     * @param first Iterator to the first element.
+     * @param last Iterator one past the last element.
+     */
+    template <typename InputIt, typename = typename iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last);
+
+    /**
+     * @brief Resizes the vector. Inserts default values if vector increases
+     *        in size.
+     *
+     * @param new_size New size of the vector.
+     */
+    void resize(size_t new_size);
+
+    /**
+     * @brief Resizes the vector.
+     *
+     * @param new_size New size of the vector. Inserts the value specified if
+     *        vector increases in size.
+     * @param x Value to be inserted.
+     */
+    void resize(size_t new_size, const T &x);
+
+    /**
+     * @brief Resizes the vector without initializing the new elements, for
+     *        buffers that are about to be filled by read(), fread() or
+     *        memcpy. Only for trivially default constructible types; the new
+     *        elements hold indeterminate values until written.
+     *
+     * @param new_size New size of the vector.
+     */
+    void resize_for_overwrite(size_t new_size);
+
+    /**
+     * @brief Subscript access to an element in a vector, similar to C-style
+     *        arrays.
+     *
+     * @param pos Index of the element to be accessed.
+     * @return T&
+     */
+    T &operator[](size_t pos);
+
+    /**
+     * @brief Subscript access to an element in a vector, similar to C-style
+     *        arrays.
+     *
+     * @param pos Index of the element to be accessed.
+     * @return T&
+     */
+    const T &operator[](size_t pos) const;
+
+    /**
+     * @brief Returns a reference to a specified element in the vector. Throws
+     *        std::out_of_range if index is not within the range of the vector.
+     *
+     * @param pos Index of element to be accessed.
+     * @return T&
+     */
+    T &at(size_t pos);
+
+    /**
+     * @brief Returns a reference to a specified element in the vector. Throws
+     *        std::out_of_range if index is not within the range of the vector.
+     *
+     * @param pos Index of element to be accessed.
+     * @return T&
+     */
+    const T &at(size_t pos) const;
+};
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline void Xvector<T, Alloc, Growth, InlineCap, Track>::destroy_elems(T *_data, size_t _size)
+{
+    if (!is_trivially_destructible<T>::value)
+        for (size_t i = 0; i < _size; i++)
+            alloc_traits::destroy(alloc, _data + i);
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline T *Xvector<T, Alloc, Growth, InlineCap, Track>::allocate_block(size_t _capacity)
+{
+    T *block = alloc.allocate(_capacity);
+    Track::template on_allocate<T>(_capacity * sizeof(T));
+    return block;
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline void Xvector<T, Alloc, Growth, InlineCap, Track>::release(T *_data, size_t _capacity)
+{
+    if (_data && _data != this->inline_data())
+    {
+        Track::template on_deallocate<T>(_capacity * sizeof(T));
+        alloc.deallocate(_data, _capacity);
+    }
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline void Xvector<T, Alloc, Growth, InlineCap, Track>::move_into(T *_src, size_t _size, T *_dest)
+{
+    if constexpr (xvector_trivially_relocatable<T>::value)
+    {
+        if (_size)
+            memcpy(static_cast<void *>(_dest), static_cast<const void *>(_src), _size * sizeof(T));
+        Track::template on_relocate<T>(_size, _size * sizeof(T), false);
+    }
+    else
+    {
+        Track::template on_relocate<T>(_size, _size * sizeof(T), !is_nothrow_move_constructible<T>::value &&
+                                                                     is_copy_constructible<T>::value);
+        size_t i = 0;
+        try
+        {
+            for (; i < _size; i++)
+                alloc_traits::construct(alloc, _dest + i, std::move_if_noexcept(_src[i]));
+        }
+        catch (...)
+        {
+            destroy_elems(_dest, i); // Only reached when copying, source is intact
+            throw;
+        }
+    }
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline void Xvector<T, Alloc, Growth, InlineCap, Track>::relocate(T *_src, size_t _size, T *_dest)
+{
+    move_into(_src, _size, _dest);
+    if constexpr (!xvector_trivially_relocatable<T>::value)
+        destroy_elems(_src, _size);
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline size_t Xvector<T, Alloc, Growth, InlineCap, Track>::next_capacity(size_t required) const
+{
+    return Growth::grow(xvector_capacity, required, sizeof(T));
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::reallocate(size_t new_capacity)
+{
+    T *new_data = allocate_block(new_capacity);
+    try
+    {
+        relocate(data, xvector_size, new_data);
+    }
+    catch (...)
+    {
+        release(new_data, new_capacity);
+        throw;
+    }
+
+    release(data, xvector_capacity); // Delete old array
+    data = new_data;
+    xvector_capacity = new_capacity;
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename... Args>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::grow_and_insert(size_t pos, Args &&...args)
+{
+    size_t new_capacity = next_capacity(xvector_size + 1);
+    T *new_data = allocate_block(new_capacity); // Allocate larger array
+    try
+    {
+        alloc_traits::construct(alloc, new_data + pos, std::forward<Args>(args)...);
+        try
+        {
+            move_into(data, pos, new_data);
+            try
+            {
+                move_into(data + pos, xvector_size - pos, new_data + pos + 1);
+            }
+            catch (...)
+            {
+                destroy_elems(new_data, pos);
+                throw;
+            }
+        }
+        catch (...)
+        {
+            alloc_traits::destroy(alloc, new_data + pos);
+            throw;
+        }
+    }
+    catch (...)
+    {
+        release(new_data, new_capacity);
+        throw;
+    }
+
+    if constexpr (!xvector_trivially_relocatable<T>::value)
+        destroy_elems(data, xvector_size);
+    release(data, xvector_capacity); // Delete old array
+    data = new_data;
+    xvector_capacity = new_capacity;
+    xvector_size++;
+}
 
-    /**
-     * @brief Resizes the vector. Inserts default values if vector increases
-     *        in size.
-     *
-     * @param new_size New size of the vector.
-     */
-    void resize(size_t new_size);
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline typename Xvector<T, Alloc, Growth, InlineCap, Track>::allocator_type Xvector<T, Alloc, Growth, InlineCap, Track>::get_allocator() const { return alloc; }
 
-    /**
-     * @brief Resizes the vector.
-     *
-     * @param new_size New size of the vector. Inserts the value specified if
-     *        vector increases in size.
-     * @param x Value to be inserted.
-     */
-    void resize(size_t new_size, const T &x);
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline Xvector<T, Alloc, Growth, InlineCap, Track>::Xvector()
+    : data(this->inline_data()), xvector_capacity(InlineCap)
+{
+}
 
-    /**
-     * @brief Subscript access to an element in a vector, similar to C-style
-     *        arrays.
-     *
-     * @param pos Index of the element to be accessed.
-     * @return T&
-     */
-    T &operator[](size_t pos);
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline Xvector<T, Alloc, Growth, InlineCap, Track>::Xvector(const Alloc &a)
+    : alloc(a), data(this->inline_data()), xvector_capacity(InlineCap)
+{
+}
 
-    /**
-     * @brief Subscript access to an element in a vector, similar to C-style
-     *        arrays.
-     *
-     * @param pos Index of the element to be accessed.
-     * @return T&
-     */
-    const T &operator[](size_t pos) const;
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename InputIt, typename>
+Xvector<T, Alloc, Growth, InlineCap, Track>::Xvector(InputIt first, InputIt last, const Alloc &a)
+    : alloc(a), data(this->inline_data()), xvector_capacity(InlineCap)
+{
+    append_range(first, last);
+}
 
-    /**
-     * @brief Returns a reference to a specified element in the vector. Throws
-     *        std::out_of_range if index is not within the range of the vector.
-     *
-     * @param pos Index of element to be accessed.
-     * @return T&
-     */
-    T &at(size_t pos);
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline Xvector<T, Alloc, Growth, InlineCap, Track>::Xvector(const Xvector &other)
+    : alloc(alloc_traits::select_on_container_copy_construction(other.alloc)), data(this->inline_data()),
+      xvector_capacity(InlineCap)
+{
+    assign_n(other.xvector_size, other.data);
+}
 
-    /**
-     * @brief Returns a reference to a specified element in the vector. Throws
-     *        std::out_of_range if index is not within the range of the vector.
-     *
-     * @param pos Index of element to be accessed.
-     * @return T&
-     */
-    const T &at(size_t pos) const;
-};
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline Xvector<T, Alloc, Growth, InlineCap, Track>::Xvector(Xvector &&other) noexcept(InlineCap == 0 || is_nothrow_move_constructible<T>::value)
+    : alloc(std::move(other.alloc)), data(this->inline_data()), xvector_capacity(InlineCap)
+{
+    steal(other);
+}
 
-template <typename T, typename Alloc>
-inline void Xvector<T, Alloc>::destroy_elems(T *_data, size_t _capacity) const
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+Xvector<T, Alloc, Growth, InlineCap, Track> &Xvector<T, Alloc, Growth, InlineCap, Track>::operator=(const Xvector &other)
 {
-    for (size_t i = 0; i < _capacity; i++)
-        _data[i].~T();
+    if (this == &other)
+        return *this;
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+    {
+        if (alloc != other.alloc)
+            clear(); // The old array must go back to the allocator that made it
+        alloc = other.alloc;
+    }
+    assign_n(other.xvector_size, other.data);
+    return *this;
 }
 
-template <typename T, typename Alloc>
-inline typename Xvector<T, Alloc>::allocator_type Xvector<T, Alloc>::get_allocator() const { return alloc; }
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+Xvector<T, Alloc, Growth, InlineCap, Track> &Xvector<T, Alloc, Growth, InlineCap, Track>::operator=(Xvector &&other) noexcept(
+    (InlineCap == 0 || is_nothrow_move_constructible<T>::value) &&
+    (allocator_traits<Alloc>::propagate_on_container_move_assignment::value || allocator_traits<Alloc>::is_always_equal::value))
+{
+    if (this == &other)
+        return *this;
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+    {
+        clear();
+        alloc = std::move(other.alloc);
+        steal(other);
+    }
+    else
+    {
+        if (alloc_traits::is_always_equal::value || alloc == other.alloc)
+        {
+            clear();
+            steal(other);
+        }
+        else // Our allocator cannot free the other array, so move the elements
+        {
+            assign_n(other.xvector_size, std::make_move_iterator(other.data));
+            other.clear();
+        }
+    }
+    return *this;
+}
 
-template <typename T, typename Alloc>
-inline Xvector<T, Alloc>::Xvector() {}
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::swap(Xvector &other)
+{
+    if (this == &other)
+        return;
+    if constexpr (InlineCap == 0)
+    {
+        if constexpr (alloc_traits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(alloc, other.alloc);
+        }
+        std::swap(data, other.data);
+        std::swap(xvector_size, other.xvector_size);
+        std::swap(xvector_capacity, other.xvector_capacity);
+    }
+    else // Inline buffers cannot change owners
+    {
+        Xvector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+}
 
-template <typename T, typename Alloc>
-inline Xvector<T, Alloc>::~Xvector()
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::steal(Xvector &other)
 {
-    if (data) // If allocated, destroy objects and deallocate
+    if (InlineCap && other.data == other.inline_data())
     {
-        destroy_elems(data, xvector_capacity);
-        alloc.deallocate(data, xvector_capacity);
+        relocate(other.data, other.xvector_size, data);
+        xvector_size = other.xvector_size;
     }
+    else
+    {
+        data = other.data;
+        xvector_size = other.xvector_size;
+        xvector_capacity = other.xvector_capacity;
+        other.data = other.inline_data();
+        other.xvector_capacity = InlineCap;
+    }
+    other.xvector_size = 0;
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline Xvector<T, Alloc, Growth, InlineCap, Track>::~Xvector()
+{
+    Track::template on_release<T>(xvector_size, xvector_capacity);
+    destroy_elems(data, xvector_size); // Destroy objects and deallocate
+    release(data, xvector_capacity);
 }
 
-template <typename T, typename Alloc>
-inline bool Xvector<T, Alloc>::empty() const
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline bool Xvector<T, Alloc, Growth, InlineCap, Track>::empty() const
 {
     return !xvector_size;
 }
 
-template <typename T, typename Alloc>
-inline typename Xvector<T, Alloc>::iterator Xvector<T, Alloc>::begin()
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline typename Xvector<T, Alloc, Growth, InlineCap, Track>::iterator Xvector<T, Alloc, Growth, InlineCap, Track>::begin()
 {
     return data;
 }
 
-template <typename T, typename Alloc>
-inline typename Xvector<T, Alloc>::const_iterator Xvector<T, Alloc>::begin() const
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline typename Xvector<T, Alloc, Growth, InlineCap, Track>::const_iterator Xvector<T, Alloc, Growth, InlineCap, Track>::begin() const
 {
     return data;
 }
 
-template <typename T, typename Alloc>
-inline typename Xvector<T, Alloc>::iterator Xvector<T, Alloc>::end()
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline typename Xvector<T, Alloc, Growth, InlineCap, Track>::iterator Xvector<T, Alloc, Growth, InlineCap, Track>::end()
 {
     return data + xvector_size;
 }
 
-template <typename T, typename Alloc>
-inline typename Xvector<T, Alloc>::const_iterator Xvector<T, Alloc>::end() const
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline typename Xvector<T, Alloc, Growth, InlineCap, Track>::const_iterator Xvector<T, Alloc, Growth, InlineCap, Track>::end() const
 {
     return data + xvector_size;
 }
 
-template <typename T, typename Alloc>
-inline size_t Xvector<T, Alloc>::size() const { return xvector_size; }
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline size_t Xvector<T, Alloc, Growth, InlineCap, Track>::size() const { return xvector_size; }
 
-template <typename T, typename Alloc>
-inline size_t Xvector<T, Alloc>::capacity() const { return xvector_capacity; }
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline size_t Xvector<T, Alloc, Growth, InlineCap, Track>::capacity() const { return xvector_capacity; }
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::reserve(size_t new_capacity)
+{
+    if (new_capacity > xvector_capacity)
+        reallocate(new_capacity);
+}
 
-template <typename T, typename Alloc>
-inline void Xvector<T, Alloc>::push_back(T &&x) // r-values
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::shrink_to_fit()
 {
-    if (empty())
+    if (xvector_capacity == xvector_size || data == this->inline_data())
+        return;
+    if (!xvector_size)
+        clear();
+    else if (xvector_size <= InlineCap) // Fits back into the inline buffer
     {
-        data = alloc.allocate(1);
-        xvector_size++;     // Increment these
-        xvector_capacity++; // Increment these
+        relocate(data, xvector_size, this->inline_data());
+        release(data, xvector_capacity);
+        data = this->inline_data();
+        xvector_capacity = InlineCap;
     }
-    else if (xvector_size == xvector_capacity)
-    {
-        xvector_capacity *= 2;                   // New capacity is double the previous
-        T *old_data = data;                      // Preserve old array for copy
-        data = alloc.allocate(xvector_capacity); // Allocate larger array
-
-        // copy values over
-        for (size_t i = 0; i < xvector_size; i++)
-        {
-            data[i] = old_data[i];
-        }
+    else
+        reallocate(xvector_size);
+}
 
-        destroy_elems(old_data, xvector_size);
-        alloc.deallocate(old_data, xvector_size); // Delete old array
-        data[xvector_size] = x;                   // Insert value one element past the rear
-        xvector_size++;                           // Increment size
-    }
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline void Xvector<T, Alloc, Growth, InlineCap, Track>::push_back(T &&x) // r-values
+{
+    if (xvector_size == xvector_capacity)
+        grow_and_insert(xvector_size, std::move(x));
     else
     {
-        data[xvector_size] = x; // Insert value one element past the rear
-        xvector_size++;         // Increment size
+        alloc_traits::construct(alloc, data + xvector_size, std::move(x)); // Insert value one element past the rear
+        xvector_size++;                                                  // Increment size
     }
 }
 
-template <typename T, typename Alloc>
-inline void Xvector<T, Alloc>::push_back(const T &x)
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline void Xvector<T, Alloc, Growth, InlineCap, Track>::push_back(const T &x)
 {
-    if (empty())
+    if (xvector_size == xvector_capacity)
+        grow_and_insert(xvector_size, x);
+    else
     {
-        data = alloc.allocate(1);
-        data[xvector_size] = x;
-        xvector_size++;     // Increment these
-        xvector_capacity++; // Increment these
+        alloc_traits::construct(alloc, data + xvector_size, x); // Insert value one element past the rear
+        xvector_size++;                                       // Increment size
     }
-    else if (xvector_size == xvector_capacity)
-    {
-        xvector_capacity *= 2;                   // New capacity is double the previous
-        T *old_data = data;                      // Preserve old array for copy
-        data = alloc.allocate(xvector_capacity); // Allocate larger array
+}
 
-        // copy values over
-        for (size_t i = 0; i < xvector_size; i++)
-        {
-            data[i] = old_data[i];
-        }
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename... Args>
+inline T &Xvector<T, Alloc, Growth, InlineCap, Track>::emplace_back(Args &&...args)
+{
+    if (xvector_size == xvector_capacity)
+        grow_and_insert(xvector_size, std::forward<Args>(args)...);
+    else
+    {
+        alloc_traits::construct(alloc, data + xvector_size, std::forward<Args>(args)...);
+        xvector_size++;
+    }
+    return data[xvector_size - 1];
+}
 
-        destroy_elems(old_data, xvector_size);
-        alloc.deallocate(old_data, xvector_size); // Delete old array
-        data[xvector_size] = x;                   // Insert value one element past the rear
-        xvector_size++;                           // Increment size
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename... Args>
+typename Xvector<T, Alloc, Growth, InlineCap, Track>::iterator Xvector<T, Alloc, Growth, InlineCap, Track>::emplace(const_iterator pos, Args &&...args)
+{
+    size_t index = pos - data;
+    if (xvector_size == xvector_capacity)
+        grow_and_insert(index, std::forward<Args>(args)...);
+    else if (index == xvector_size)
+    {
+        alloc_traits::construct(alloc, data + xvector_size, std::forward<Args>(args)...);
+        xvector_size++;
     }
     else
     {
-        data[xvector_size] = x; // Insert value one element past the rear
-        xvector_size++;         // Increment size
+        T tmp(std::forward<Args>(args)...); // args may refer to an element that is about to shift
+        if constexpr (xvector_trivially_relocatable<T>::value)
+        {
+            memmove(static_cast<void *>(data + index + 1), static_cast<const void *>(data + index),
+                    (xvector_size - index) * sizeof(T));
+            alloc_traits::construct(alloc, data + index, std::move(tmp));
+        }
+        else
+        {
+            alloc_traits::construct(alloc, data + xvector_size, std::move(data[xvector_size - 1]));
+            std::move_backward(data + index, data + xvector_size - 1, data + xvector_size);
+            data[index] = std::move(tmp);
+        }
+        xvector_size++;
     }
+    return data + index;
 }
 
-template <typename T, typename Alloc>
-inline void Xvector<T, Alloc>::pop_back()
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline void Xvector<T, Alloc, Growth, InlineCap, Track>::pop_back()
 {
     if (!empty() && data)
+    {
         xvector_size--; // Reduce size by one
+        alloc_traits::destroy(alloc, data + xvector_size);
+    }
 }
 
-template <typename T, typename Alloc>
-void Xvector<T, Alloc>::clear()
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::clear()
 {
-    destroy_elems(data, xvector_capacity);
-    alloc.deallocate(data, xvector_capacity);
-    data = nullptr;
-    xvector_size = xvector_capacity = 0;
+    Track::template on_release<T>(xvector_size, xvector_capacity);
+    destroy_elems(data, xvector_size);
+    release(data, xvector_capacity);
+    data = this->inline_data(); // Back to the inline buffer, if any
+    xvector_size = 0;
+    xvector_capacity = InlineCap;
 }
 
-template <typename T, typename Alloc>
-void Xvector<T, Alloc>::erase(size_t pos)
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename ForwardIt>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::construct_n(T *dest, size_t n, ForwardIt first)
 {
-    if (!empty() && (pos > xvector_size))
+    if constexpr (bulk_copyable<ForwardIt>)
+    {
+        if (n)
+            memcpy(static_cast<void *>(dest), static_cast<const void *>(first), n * sizeof(T));
+    }
+    else
     {
-        T *old_data = data;
-        data = alloc.allocate(xvector_capacity);
-        for (size_t i = 0; i < xvector_size; i++)
+        size_t built = 0;
+        try
         {
-            if (i != pos)
-                data[i] = old_data[i];
+            for (; built < n; ++built, ++first)
+                alloc_traits::construct(alloc, dest + built, *first);
+        }
+        catch (...)
+        {
+            destroy_elems(dest, built);
+            throw;
         }
     }
 }
 
-template <typename T, typename Alloc>
-void Xvector<T, Alloc>::resize(size_t new_size)
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename ForwardIt>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::insert_n(size_t index, size_t n, ForwardIt first)
 {
-    if (!data) // not allocated
+    if (!n)
+        return;
+
+    if (xvector_size + n > xvector_capacity) // Build the new array around the inserted elements
     {
-        data = alloc.allocate(new_size);
-        xvector_size = new_size;
-        xvector_capacity = new_size;
-        for (size_t i = 0; i < xvector_size; i++)
+        size_t new_capacity = next_capacity(xvector_size + n);
+        T *new_data = allocate_block(new_capacity);
+        try
         {
-            data[i] = T();
+            construct_n(new_data + index, n, first);
         }
-    }
-    else if (new_size == xvector_size) // equal size
-    {
-        return;
-    }
-    else if (new_size < xvector_size) // smaller size
-    {
-        xvector_size = new_size;
-    }
-    else // larger size
-    {
-        if (new_size <= xvector_capacity) // smaller than capacity
+        catch (...)
         {
-            for (size_t i = xvector_size; i < new_size; i++)
-            {
-                data[i] = T();
-            }
-            xvector_size = new_size;
+            release(new_data, new_capacity);
+            throw;
         }
-        else
+        try
         {
-            T *old_data = data;              // preserve old array
-            data = alloc.allocate(new_size); // allocate larger array
-            for (size_t i = 0; i < xvector_size; i++)
+            move_into(data, index, new_data);
+            try
             {
-                data[i] = old_data[i];
+                move_into(data + index, xvector_size - index, new_data + index + n);
             }
-
-            destroy_elems(old_data, xvector_size);
-            alloc.deallocate(old_data, xvector_size);
-            for (size_t i = xvector_size; i < new_size; i++)
+            catch (...)
             {
-                data[i] = T();
+                destroy_elems(new_data, index);
+                throw;
             }
-            xvector_size = new_size;
-            xvector_capacity = new_size;
         }
+        catch (...)
+        {
+            destroy_elems(new_data + index, n);
+            release(new_data, new_capacity);
+            throw;
+        }
+
+        if constexpr (!xvector_trivially_relocatable<T>::value)
+            destroy_elems(data, xvector_size);
+        release(data, xvector_capacity);
+        data = new_data;
+        xvector_capacity = new_capacity;
+        xvector_size += n;
+        return;
+    }
+
+    T *pos = data + index;
+    T *old_end = data + xvector_size;
+    size_t after = xvector_size - index;
+
+    if constexpr (xvector_trivially_relocatable<T>::value)
+    {
+        memmove(static_cast<void *>(pos + n), static_cast<const void *>(pos), after * sizeof(T));
+        try
+        {
+            construct_n(pos, n, first);
+        }
+        catch (...)
+        {
+            memmove(static_cast<void *>(pos), static_cast<const void *>(pos + n), after * sizeof(T));
+            throw;
+        }
+        xvector_size += n;
+    }
+    else if (after > n) // The tail spills n elements into uninitialized storage
+    {
+        for (size_t i = 0; i < n; i++, xvector_size++)
+            alloc_traits::construct(alloc, old_end + i, std::move((old_end - n)[i]));
+        std::move_backward(pos, old_end - n, old_end);
+        for (size_t i = 0; i < n; i++, ++first)
+            pos[i] = *first;
+    }
+    else // The inserted range spills into uninitialized storage
+    {
+        ForwardIt mid = first;
+        for (size_t i = 0; i < after; i++)
+            ++mid;
+        construct_n(old_end, n - after, mid);
+        xvector_size += n - after;
+        for (size_t i = 0; i < after; i++, xvector_size++)
+            alloc_traits::construct(alloc, pos + n + i, std::move(pos[i]));
+        for (size_t i = 0; i < after; i++, ++first)
+            pos[i] = *first;
     }
 }
 
-template <typename T, typename Alloc>
-void Xvector<T, Alloc>::resize(size_t new_size, const T &x)
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename ForwardIt>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::assign_n(size_t n, ForwardIt first)
 {
-    if (!data) // not allocated
+    if constexpr (bulk_copyable<ForwardIt>) // Copying from an array of T: one memcpy
     {
-        data = alloc.allocate(new_size);
-        xvector_size = new_size;
-        xvector_capacity = new_size;
-        for (size_t i = 0; i < xvector_size; i++)
+        T *dest = n > xvector_capacity ? allocate_block(n) : data;
+        if (n)
+            memmove(static_cast<void *>(dest), static_cast<const void *>(first), n * sizeof(T)); // Source may be our own array
+        if (dest != data)
         {
-            data[i] = x;
+            clear();
+            data = dest;
+            xvector_capacity = n;
         }
+        xvector_size = n;
+        return;
     }
-    else if (new_size == xvector_size) // equal size
+
+    if (n > xvector_capacity)
     {
+        T *new_data = allocate_block(n);
+        try
+        {
+            construct_n(new_data, n, first);
+        }
+        catch (...)
+        {
+            release(new_data, n);
+            throw;
+        }
+        clear();
+        data = new_data;
+        xvector_size = xvector_capacity = n;
         return;
     }
-    else if (new_size < xvector_size) // smaller size
+
+    size_t common = n < xvector_size ? n : xvector_size;
+    for (size_t i = 0; i < common; i++, ++first)
+        data[i] = *first;
+    if (n < xvector_size)
+        destroy_elems(data + n, xvector_size - n);
+    else
+        for (; xvector_size < n; xvector_size++, ++first)
+            alloc_traits::construct(alloc, data + xvector_size, *first);
+    xvector_size = n;
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline typename Xvector<T, Alloc, Growth, InlineCap, Track>::iterator Xvector<T, Alloc, Growth, InlineCap, Track>::erase(const_iterator pos)
+{
+    return erase(pos, pos + 1);
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+typename Xvector<T, Alloc, Growth, InlineCap, Track>::iterator Xvector<T, Alloc, Growth, InlineCap, Track>::erase(const_iterator first, const_iterator last)
+{
+    T *dest = data + (first - data);
+    size_t count = last - first;
+    if (!count)
+        return dest;
+
+    T *src = dest + count;
+    T *old_end = data + xvector_size;
+    if constexpr (xvector_trivially_relocatable<T>::value)
+    {
+        destroy_elems(dest, count);
+        memmove(static_cast<void *>(dest), static_cast<const void *>(src), (old_end - src) * sizeof(T));
+    }
+    else
+    {
+        std::move(src, old_end, dest);
+        destroy_elems(old_end - count, count);
+    }
+    xvector_size -= count;
+    return dest;
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename InputIt, typename>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::append_range(InputIt first, InputIt last)
+{
+    using category = typename iterator_traits<InputIt>::iterator_category;
+    if constexpr (is_base_of<forward_iterator_tag, category>::value)
+        insert_n(xvector_size, std::distance(first, last), first);
+    else // Unknown length: nothing to shift, so plain appends are enough
+        for (; first != last; ++first)
+            emplace_back(*first);
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline void Xvector<T, Alloc, Growth, InlineCap, Track>::append(const T *first, size_t count)
+{
+    insert_n(xvector_size, count, first);
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+typename Xvector<T, Alloc, Growth, InlineCap, Track>::iterator Xvector<T, Alloc, Growth, InlineCap, Track>::insert(const_iterator pos, size_t n, const T &x)
+{
+    size_t index = pos - data;
+    T tmp(x); // x may refer to an element that is about to shift
+    insert_n(index, n, fill_iterator{&tmp});
+    return data + index;
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename InputIt, typename>
+typename Xvector<T, Alloc, Growth, InlineCap, Track>::iterator Xvector<T, Alloc, Growth, InlineCap, Track>::insert(const_iterator pos, InputIt first, InputIt last)
+{
+    size_t index = pos - data;
+    using category = typename iterator_traits<InputIt>::iterator_category;
+    if constexpr (is_base_of<forward_iterator_tag, category>::value)
+        insert_n(index, std::distance(first, last), first);
+    else // Single pass: gather first so the tail still shifts only once
+    {
+        Xvector<T, Alloc, Growth, InlineCap, Track> tmp(alloc);
+        for (; first != last; ++first)
+            tmp.emplace_back(*first);
+        insert_n(index, tmp.size(), std::make_move_iterator(tmp.begin()));
+    }
+    return data + index;
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::assign(size_t n, const T &x)
+{
+    T tmp(x); // x may refer to an element that is about to be overwritten
+    assign_n(n, fill_iterator{&tmp});
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+template <typename InputIt, typename>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::assign(InputIt first, InputIt last)
+{
+    using category = typename iterator_traits<InputIt>::iterator_category;
+    if constexpr (is_base_of<forward_iterator_tag, category>::value)
+        assign_n(std::distance(first, last), first);
+    else
+    {
+        destroy_elems(data, xvector_size);
+        xvector_size = 0;
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::resize(size_t new_size)
+{
+    if (new_size <= xvector_size) // smaller or equal size
     {
+        destroy_elems(data + new_size, xvector_size - new_size);
         xvector_size = new_size;
+        return;
     }
-    else // larger size
+
+    if (new_size > xvector_capacity) // larger than capacity
+        reallocate(new_size);
+
+    size_t built = xvector_size; // Local counter so the loop keeps it in a register
+    try
     {
-        if (new_size <= xvector_capacity) // smaller than capacity
-        {
-            for (size_t i = xvector_size; i < new_size; i++)
-            {
-                data[i] = x;
-            }
-            xvector_size = new_size;
-        }
-        else
-        {
-            T *old_data = data;              // preserve old array
-            data = alloc.allocate(new_size); // allocate larger array
-            for (size_t i = 0; i < xvector_size; i++)
-            {
-                data[i] = old_data[i];
-            }
+        for (; built < new_size; built++)
+            alloc_traits::construct(alloc, data + built); // Value-initialize new slots
+    }
+    catch (...)
+    {
+        destroy_elems(data + xvector_size, built - xvector_size);
+        throw;
+    }
+    xvector_size = new_size;
+}
 
-            destroy_elems(old_data, xvector_size);
-            alloc.deallocate(old_data, xvector_size);
-            for (size_t i = xvector_size; i < new_size; i++)
-            {
-                data[i] = x;
-            }
-            xvector_size = new_size;
-            xvector_capacity = new_size;
-        }
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::resize_for_overwrite(size_t new_size)
+{
+    static_assert(is_trivially_default_constructible<T>::value,
+                  "Xvector::resize_for_overwrite requires a trivially default constructible type");
+    if (new_size > xvector_capacity)
+        reallocate(new_size);
+    xvector_size = new_size; // Trivial types need no construction or destruction
+}
+
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+void Xvector<T, Alloc, Growth, InlineCap, Track>::resize(size_t new_size, const T &x)
+{
+    if (new_size <= xvector_size) // smaller or equal size
+    {
+        destroy_elems(data + new_size, xvector_size - new_size);
+        xvector_size = new_size;
+        return;
+    }
+
+    if (new_size > xvector_capacity) // larger than capacity
+    {
+        T tmp(x); // x may refer to an element that is about to be relocated
+        reallocate(new_size);
+        for (; xvector_size < new_size; xvector_size++)
+            alloc_traits::construct(alloc, data + xvector_size, tmp);
+        return;
     }
+
+    for (; xvector_size < new_size; xvector_size++)
+        alloc_traits::construct(alloc, data + xvector_size, x);
 }
 
-template <typename T, typename Alloc>
-T &Xvector<T, Alloc>::operator[](size_t pos)
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+T &Xvector<T, Alloc, Growth, InlineCap, Track>::operator[](size_t pos)
 {
     return data[pos];
 }
 
-template <typename T, typename Alloc>
-const T &Xvector<T, Alloc>::operator[](size_t pos) const
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+const T &Xvector<T, Alloc, Growth, InlineCap, Track>::operator[](size_t pos) const
 {
     return data[pos];
 }
 
-template <typename T, typename Alloc>
-T &Xvector<T, Alloc>::at(size_t pos)
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+T &Xvector<T, Alloc, Growth, InlineCap, Track>::at(size_t pos)
 {
     try
     {
@@ -492,8 +1681,8 @@ T &Xvector<T, Alloc>::at(size_t pos)
     return data[pos];
 }
 
-template <typename T, typename Alloc>
-const T &Xvector<T, Alloc>::at(size_t pos) const
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+const T &Xvector<T, Alloc, Growth, InlineCap, Track>::at(size_t pos) const
 {
     try
     {
@@ -506,4 +1695,78 @@ const T &Xvector<T, Alloc>::at(size_t pos) const
     }
 
     return data[pos];
-}
\ No newline at end of file
+}
+/**
+ * @brief Erases every element that satisfies a predicate in a single pass,
+ *        e.g. filtering stop-words out of a loaded dictionary. Each surviving
+ *        element is moved at most once.
+ *
+ * @tparam T type of element.
+ * @tparam Alloc type of allocator.
+ * @tparam Growth growth policy.
+ * @tparam InlineCap number of inline elements.
+ * @tparam Track instrumentation policy.
+ * @tparam Pred type of predicate.
+ * @param v Vector to filter.
+ * @param pred Returns true for elements to erase.
+ * @return size_t number of elements erased.
+ */
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track, typename Pred>
+size_t erase_if(Xvector<T, Alloc, Growth, InlineCap, Track> &v, Pred pred)
+{
+    auto last = v.end();
+    auto kept = std::find_if(v.begin(), last, pred);
+    if (kept == last)
+        return 0;
+    for (auto it = kept + 1; it != last; ++it)
+        if (!pred(*it))
+            *kept++ = std::move(*it);
+    size_t erased = last - kept;
+    v.erase(kept, last);
+    return erased;
+}
+
+/**
+ * @brief Exchanges the contents of two vectors.
+ *
+ * @tparam T type of element.
+ * @tparam Alloc type of allocator.
+ * @tparam Growth growth policy.
+ * @tparam InlineCap number of inline elements.
+ * @tparam Track instrumentation policy.
+ * @param a First vector.
+ * @param b Second vector.
+ */
+template <typename T, typename Alloc, typename Growth, size_t InlineCap, typename Track>
+inline void swap(Xvector<T, Alloc, Growth, InlineCap, Track> &a, Xvector<T, Alloc, Growth, InlineCap, Track> &b)
+{
+    a.swap(b);
+}
+
+/**
+ * @brief An Xvector that stores up to N elements inside the object itself and
+ *        only allocates through Alloc once it overflows. Meant for short-lived
+ *        vectors that usually stay small.
+ *
+ * @tparam T type of element.
+ * @tparam N number of elements stored inline.
+ * @tparam Alloc type of allocator used after spilling, default is
+ *         std::allocator<T>
+ * @tparam Growth growth policy used after spilling, default is
+ *         xvector_growth_double
+ */
+template <typename T, size_t N, typename Alloc = std::allocator<T>, typename Growth = xvector_growth_double>
+using SmallXvector = Xvector<T, Alloc, Growth, N>;
+
+/**
+ * @brief An Xvector whose allocations and growth are counted by
+ *        xvector_tracking. A distinct type from the untracked Xvector<T>, so
+ *        instrumenting one call site never changes the type other
+ *        translation units see.
+ *
+ * @tparam T type of element.
+ * @tparam Site tag type naming the call site, default is void (per type only).
+ * @tparam Alloc type of allocator, default is std::allocator<T>
+ */
+template <typename T, typename Site = void, typename Alloc = std::allocator<T>>
+using TrackedXvector = Xvector<T, Alloc, xvector_growth_double, 0, xvector_tracking<Site>>;
@@ -0,0 +1,208 @@
+/**
+ * @file Xwriter.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Buffered bulk writer for dumping word lists to a file. Output is
+ *        gathered into one large buffer and handed to the C library a block
+ *        at a time, bypassing stream formatting.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <cstdio>      // for FILE, fopen, fwrite
+#include <cstring>     // for memcpy
+#include <stdexcept>   // for basic exceptions
+#include <string>      // for string
+#include <string_view> // for string_view
+#include "Xvector.hpp"
+using namespace std;
+
+/**
+ * @brief Writes bytes to a file through a large buffer. Throws
+ *        std::runtime_error if the file cannot be opened or written. The
+ *        destructor flushes but cannot report errors; call close() to see
+ *        them.
+ *
+ */
+class Xwriter
+{
+private:
+    FILE *file{nullptr};  // Output file
+    Xvector<char> buffer; // Holds pending bytes, its size is the flush threshold
+    size_t pending{0};    // Number of bytes in buffer waiting to be written
+
+    /**
+     * @brief Writes bytes straight to the file.
+     *
+     * @param p Pointer to the bytes.
+     * @param n Number of bytes.
+     */
+    void write_through(const char *p, size_t n);
+
+public:
+    /**
+     * @brief Opens (and truncates) the file at the given path.
+     *
+     * @param path Path of the file.
+     * @param buffer_bytes Size of the buffer, default is 1 MiB.
+     */
+    explicit Xwriter(const char *path, size_t buffer_bytes = 1 << 20);
+
+    /**
+     * @brief Flushes pending bytes and closes the file, ignoring errors.
+     *
+     */
+    ~Xwriter();
+
+    Xwriter(const Xwriter &) = delete;
+    Xwriter &operator=(const Xwriter &) = delete;
+
+    /**
+     * @brief Appends bytes to the output.
+     *
+     * @param s The bytes to be written.
+     */
+    void write(string_view s);
+
+    /**
+     * @brief Appends one character to the output.
+     *
+     * @param c The character to be written.
+     */
+    void put(char c);
+
+    /**
+     * @brief Writes every element of a range with a separator between
+     *        consecutive elements and none after the last, so no element has
+     *        to be compared to find the end.
+     *
+     * @tparam InputIt type of iterator, its elements convert to string_view.
+     * @param first Iterator to the first element.
+     * @param last Iterator one past the last element.
+     * @param sep Separator written between elements.
+     */
+    template <typename InputIt>
+    void write_joined(InputIt first, InputIt last, string_view sep);
+
+    /**
+     * @brief Hands pending bytes to the file.
+     *
+     */
+    void flush();
+
+    /**
+     * @brief Flushes and closes the file. Throws std::runtime_error if any
+     *        write failed. Writes after this throw std::runtime_error once
+     *        they reach the file.
+     *
+     */
+    void close();
+};
+
+inline Xwriter::Xwriter(const char *path, size_t buffer_bytes)
+{
+    file = fopen(path, "wb");
+    if (!file)
+        throw runtime_error(string("Xwriter: cannot open ") + path);
+    setvbuf(file, nullptr, _IONBF, 0); // Our buffer replaces stdio's
+    buffer.resize_for_overwrite(buffer_bytes ? buffer_bytes : 1); // Every byte is written before it is flushed
+}
+
+inline Xwriter::~Xwriter()
+{
+    if (!file)
+        return;
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
+    fclose(file);
+}
+
+inline void Xwriter::write_through(const char *p, size_t n)
+{
+    if (n && !file)
+        throw runtime_error("Xwriter: write after close");
+    if (n && fwrite(p, 1, n, file) != n)
+        throw runtime_error("Xwriter: write failed");
+}
+
+inline void Xwriter::write(string_view s)
+{
+    if (s.size() > buffer.size() - pending)
+    {
+        flush();
+        if (s.size() >= buffer.size()) // Too big to be worth buffering
+        {
+            write_through(s.data(), s.size());
+            return;
+        }
+    }
+    memcpy(buffer.begin() + pending, s.data(), s.size());
+    pending += s.size();
+}
+
+inline void Xwriter::put(char c)
+{
+    if (pending == buffer.size())
+        flush();
+    buffer[pending++] = c;
+}
+
+template <typename InputIt>
+void Xwriter::write_joined(InputIt first, InputIt last, string_view sep)
+{
+    if (first == last)
+        return;
+    write(*first);
+    for (++first; first != last; ++first)
+    {
+        string_view s = *first;
+        if (sep.size() + s.size() <= buffer.size() - pending) // One bounds check per element
+        {
+            char *out = buffer.begin() + pending;
+            memcpy(out, sep.data(), sep.size());
+            memcpy(out + sep.size(), s.data(), s.size());
+            pending += sep.size() + s.size();
+        }
+        else
+        {
+            write(sep);
+            write(s);
+        }
+    }
+}
+
+inline void Xwriter::flush()
+{
+    write_through(buffer.begin(), pending);
+    pending = 0;
+}
+
+inline void Xwriter::close()
+{
+    if (!file)
+        return;
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+        fclose(file);
+        file = nullptr;
+        throw;
+    }
+    int status = fclose(file);
+    file = nullptr;
+    if (status != 0)
+        throw runtime_error("Xwriter: close failed");
+}
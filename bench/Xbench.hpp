@@ -0,0 +1,225 @@
+/**
+ * @file Xbench.hpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Tiny header-only timing harness shared by the benchmarks in this
+ *        directory. No dependencies beyond the standard library. Results can
+ *        be collected with Xbench and written as a table, CSV or JSON.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <chrono>  // for steady_clock
+#include <cstddef> // for size_t
+#include <cstdio>  // for printf, FILE
+#include <cstdlib> // for strtoul
+#include <cstring> // for strncmp
+#include <limits>  // for numeric_limits
+#include <string>  // for string
+#include <vector>  // for vector of results
+#ifdef __GLIBC__
+#include <malloc.h> // for mallopt
+#endif
+using namespace std;
+
+/**
+ * @brief Keeps the compiler from optimizing away a value the benchmark does
+ *        not otherwise use.
+ *
+ * @tparam T type of the value.
+ * @param value Value to keep alive.
+ */
+template <typename T>
+inline void do_not_optimize(T const &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Keeps the compiler from reordering or eliding memory writes across
+ *        this point.
+ *
+ */
+inline void clobber_memory()
+{
+    asm volatile("" : : : "memory");
+}
+
+/**
+ * @brief Runs a function several times and returns the fastest run. The
+ *        minimum is the most reproducible statistic on a noisy machine.
+ *
+ * @tparam Fn type of the function.
+ * @param reps Number of runs.
+ * @param fn Function to time.
+ * @return double fastest run in nanoseconds.
+ */
+template <typename Fn>
+inline double xbench_min_ns(size_t reps, Fn &&fn)
+{
+    double best = numeric_limits<double>::max();
+    for (size_t i = 0; i < reps; i++)
+    {
+        auto start = chrono::steady_clock::now();
+        fn();
+        clobber_memory();
+        auto stop = chrono::steady_clock::now();
+        double ns = chrono::duration<double, nano>(stop - start).count();
+        if (ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+/**
+ * @brief Prints one result line: name, total time and time per item.
+ *
+ * @param name Name of the benchmark.
+ * @param ns Time of one run in nanoseconds.
+ * @param items Number of items processed in one run.
+ */
+inline void xbench_report(const char *name, double ns, size_t items)
+{
+    printf("%-40s %12.3f ms %10.2f ns/item\n", name, ns / 1e6, items ? ns / items : ns);
+}
+
+/**
+ * @brief One measurement: a named operation on a container of some element
+ *        type, the items it processed and its fastest run.
+ *
+ */
+struct xbench_result
+{
+    string op;        // Operation, e.g. "push_back"
+    string container; // Container, e.g. "Xvector"
+    string type;      // Element type, e.g. "int"
+    size_t items;     // Items processed per run
+    double ns;        // Fastest run in nanoseconds
+};
+
+/**
+ * @brief Collects results and writes them in the format chosen on the command
+ *        line:
+ *
+ *        --format=table|csv|json  output format, default is table
+ *        --out=PATH               write to PATH instead of stdout
+ *        --reps=N                 runs per measurement, default is 10
+ *
+ *        JSON output records the compiler and the repetition count so results
+ *        from different builds can be told apart. On glibc the heap is kept
+ *        from trimming or mmapping large blocks, so a measurement does not
+ *        depend on what ran before it.
+ */
+class Xbench
+{
+private:
+    vector<xbench_result> results;
+    string format{"table"};
+    string out_path;
+    size_t repetitions{10};
+
+public:
+    /**
+     * @brief Parses the options above from the command line.
+     *
+     * @param argc Argument count.
+     * @param argv Argument values.
+     */
+    Xbench(int argc, char *argv[])
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            if (!strncmp(argv[i], "--format=", 9))
+                format = argv[i] + 9;
+            else if (!strncmp(argv[i], "--out=", 6))
+                out_path = argv[i] + 6;
+            else if (!strncmp(argv[i], "--reps=", 7))
+                repetitions = strtoul(argv[i] + 7, nullptr, 10);
+        }
+        if (!repetitions)
+            repetitions = 1;
+#ifdef __GLIBC__
+        mallopt(M_TRIM_THRESHOLD, 1 << 30);
+        mallopt(M_MMAP_THRESHOLD, 1 << 30);
+#endif
+    }
+
+    /**
+     * @brief Returns the number of runs per measurement.
+     *
+     * @return size_t
+     */
+    size_t reps() const { return repetitions; }
+
+    /**
+     * @brief Times a function and records the fastest run. One untimed run
+     *        comes first so that whichever container is measured first does
+     *        not pay for warming up the heap.
+     *
+     * @tparam Fn type of the function.
+     * @param op Operation name.
+     * @param container Container name.
+     * @param type Element type name.
+     * @param items Items processed per run.
+     * @param fn Function to time.
+     */
+    template <typename Fn>
+    void run(const string &op, const string &container, const string &type, size_t items, Fn &&fn)
+    {
+        fn();
+        results.push_back({op, container, type, items, xbench_min_ns(repetitions, fn)});
+    }
+
+    /**
+     * @brief Writes every result in the chosen format. Returns false if the
+     *        output file cannot be opened.
+     *
+     * @return bool
+     */
+    bool write() const
+    {
+        FILE *f = out_path.empty() ? stdout : fopen(out_path.c_str(), "w");
+        if (!f)
+            return false;
+
+        if (format == "csv")
+        {
+            fprintf(f, "op,container,type,items,ns,ns_per_item\n");
+            for (const xbench_result &r : results)
+                fprintf(f, "%s,%s,%s,%zu,%.1f,%.4f\n", r.op.c_str(), r.container.c_str(), r.type.c_str(),
+                        r.items, r.ns, r.ns / r.items);
+        }
+        else if (format == "json")
+        {
+#ifdef __VERSION__
+            const char *compiler = __VERSION__;
+#else
+            const char *compiler = "unknown";
+#endif
+            fprintf(f, "{\n  \"compiler\": \"%s\",\n  \"reps\": %zu,\n  \"results\": [\n", compiler, repetitions);
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                const xbench_result &r = results[i];
+                fprintf(f, "    {\"op\": \"%s\", \"container\": \"%s\", \"type\": \"%s\", \"items\": %zu, "
+                           "\"ns\": %.1f, \"ns_per_item\": %.4f}%s\n",
+                        r.op.c_str(), r.container.c_str(), r.type.c_str(), r.items, r.ns, r.ns / r.items,
+                        i + 1 < results.size() ? "," : "");
+            }
+            fprintf(f, "  ]\n}\n");
+        }
+        else
+        {
+            for (const xbench_result &r : results)
+                fprintf(f, "%-14s %-12s %-8s %12.3f ms %10.2f ns/item\n", r.op.c_str(), r.container.c_str(),
+                        r.type.c_str(), r.ns / 1e6, r.ns / r.items);
+        }
+
+        if (f != stdout)
+            fclose(f);
+        return true;
+    }
+};
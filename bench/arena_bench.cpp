@@ -0,0 +1,135 @@
+/**
+ * @file arena_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Loads the dictionary into Xvectors backed by std::allocator, by an
+ *        Xarena and by the thread-local arena, and reports heap allocations
+ *        during the load and the time to tear everything down.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. arena_bench.cpp -o arena_bench
+ *        Run:   ./arena_bench [path to dictionary.txt]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Xvector.hpp"
+#include "Xarena.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+size_t heap_allocations = 0; // Calls to the global operator new
+
+void *operator new(size_t bytes)
+{
+    heap_allocations++;
+    if (void *p = malloc(bytes ? bytes : 1))
+        return p;
+    throw bad_alloc();
+}
+
+void operator delete(void *p) noexcept { free(p); }
+
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+using arena_string = basic_string<char, char_traits<char>, xarena_allocator<char>>;
+using thread_string = basic_string<char, char_traits<char>, xarena_thread_allocator<char>>;
+
+/**
+ * @brief Prints one result line.
+ *
+ * @param name Name of the case.
+ * @param load_ns Time to load the words.
+ * @param allocs Heap allocations during the load.
+ * @param teardown_ns Time to destroy the vector and release its memory.
+ */
+void report(const char *name, double load_ns, size_t allocs, double teardown_ns)
+{
+    printf("%-28s load %8.2f ms %10zu heap allocs   teardown %8.3f ms\n", name, load_ns / 1e6, allocs,
+           teardown_ns / 1e6);
+}
+
+double elapsed_ns(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "../dictionary.txt";
+    ifstream infile(path);
+    vector<string> source;
+    string word;
+    while (infile >> word)
+        source.push_back(word);
+    if (source.empty())
+    {
+        fprintf(stderr, "could not read words from %s\n", path);
+        return 1;
+    }
+
+    {
+        heap_allocations = 0;
+        auto start = chrono::steady_clock::now();
+        optional<Xvector<string>> words(in_place);
+        for (const string &s : source)
+            words->emplace_back(s.data(), s.size());
+        double load = elapsed_ns(start);
+        size_t allocs = heap_allocations;
+        start = chrono::steady_clock::now();
+        words.reset();
+        report("std::allocator", load, allocs, elapsed_ns(start));
+    }
+
+    {
+        Xarena arena(1 << 20);
+        heap_allocations = 0;
+        auto start = chrono::steady_clock::now();
+        xarena_allocator<char> chars(arena);
+        optional<Xvector<arena_string, xarena_allocator<arena_string>>> words(in_place, arena);
+        for (const string &s : source)
+            words->emplace_back(s.data(), s.size(), chars);
+        double load = elapsed_ns(start);
+        size_t allocs = heap_allocations;
+        start = chrono::steady_clock::now();
+        words.reset();
+        arena.reset();
+        report("Xarena", load, allocs, elapsed_ns(start));
+    }
+
+    {
+        Xarena arena(1 << 20);
+        heap_allocations = 0;
+        auto start = chrono::steady_clock::now();
+        optional<Xvector<size_t, xarena_allocator<size_t>>> ids(in_place, arena);
+        for (size_t i = 0; i < source.size(); i++)
+            ids->push_back(i);
+        double load = elapsed_ns(start);
+        size_t allocs = heap_allocations;
+        start = chrono::steady_clock::now();
+        ids.reset(); // Trivially destructible: nothing to destroy, nothing to free
+        arena.reset();
+        report("Xarena (size_t ids)", load, allocs, elapsed_ns(start));
+    }
+
+    {
+        xarena_thread_local().reset();
+        heap_allocations = 0;
+        auto start = chrono::steady_clock::now();
+        optional<Xvector<thread_string, xarena_thread_allocator<thread_string>>> words(in_place);
+        for (const string &s : source)
+            words->emplace_back(s.data(), s.size());
+        double load = elapsed_ns(start);
+        size_t allocs = heap_allocations;
+        start = chrono::steady_clock::now();
+        words.reset();
+        xarena_thread_local().reset();
+        report("thread-local Xarena", load, allocs, elapsed_ns(start));
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file chunked_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares the tail latency of push_back into a ChunkedXvector with
+ *        push_back into an Xvector, whose growth copies the whole array. The
+ *        pushes are timed in batches, and the percentiles of the batch times
+ *        show the spikes; a full scan of each container is timed as well.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. chunked_bench.cpp -o chunked_bench
+ *        Run:   ./chunked_bench [elements in millions]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include "Xvector.hpp"
+#include "ChunkedXvector.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+const size_t batch = 1024; // Pushes per timed batch
+
+/**
+ * @brief Pushes n values and prints percentiles of the time per batch.
+ *
+ */
+template <typename Vec>
+void push_latency(const char *name, size_t n)
+{
+    vector<double> batch_ns;
+    batch_ns.reserve(n / batch + 1);
+    auto total_start = chrono::steady_clock::now();
+    {
+        Vec v;
+        for (size_t i = 0; i < n; i += batch)
+        {
+            auto start = chrono::steady_clock::now();
+            for (size_t j = i; j < i + batch && j < n; j++)
+                v.push_back(j);
+            batch_ns.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - start).count());
+        }
+        do_not_optimize(&v);
+    }
+    double total_ns = chrono::duration<double, nano>(chrono::steady_clock::now() - total_start).count();
+
+    sort(batch_ns.begin(), batch_ns.end());
+    auto pct = [&](double p) { return batch_ns[size_t(p * (batch_ns.size() - 1))] / 1e3; };
+    printf("%-16s total %8.1f ms  batch of %zu (us): p50 %8.1f  p99 %8.1f  p99.99 %9.1f  max %9.1f\n", name,
+           total_ns / 1e6, batch, pct(0.5), pct(0.99), pct(0.9999), batch_ns.back() / 1e3);
+}
+
+int main(int argc, char *argv[])
+{
+    size_t n = (argc > 1 ? strtoul(argv[1], nullptr, 10) : 64) * 1000000;
+
+    push_latency<Xvector<uint64_t>>("Xvector", n);
+    push_latency<ChunkedXvector<uint64_t>>("ChunkedXvector", n);
+
+    Xvector<uint64_t> flat;
+    ChunkedXvector<uint64_t> chunked;
+    for (size_t i = 0; i < n; i++)
+    {
+        flat.push_back(i);
+        chunked.push_back(i);
+    }
+
+    double flat_ns = xbench_min_ns(5, [&]
+    {
+        uint64_t sum = 0;
+        for (uint64_t x : flat)
+            sum += x;
+        do_not_optimize(sum);
+    });
+    double iter_ns = xbench_min_ns(5, [&]
+    {
+        uint64_t sum = 0;
+        for (uint64_t x : chunked)
+            sum += x;
+        do_not_optimize(sum);
+    });
+    double chunk_ns = xbench_min_ns(5, [&]
+    {
+        uint64_t sum = 0;
+        chunked.for_each_chunk([&](const uint64_t *first, const uint64_t *last)
+        {
+            for (; first != last; ++first)
+                sum += *first;
+        });
+        do_not_optimize(sum);
+    });
+
+    xbench_report("scan Xvector", flat_ns, n);
+    xbench_report("scan ChunkedXvector iterator", iter_ns, n);
+    xbench_report("scan ChunkedXvector chunks", chunk_ns, n);
+}
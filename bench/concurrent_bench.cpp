@@ -0,0 +1,102 @@
+/**
+ * @file concurrent_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Measures push_back throughput from 1 to N threads into one
+ *        ConcurrentXvector, against one Xvector guarded by a mutex, and
+ *        checks that every pushed value arrives exactly once.
+ *
+ *        Build: g++ -std=c++17 -O2 -pthread -I.. concurrent_bench.cpp -o concurrent_bench
+ *        Run:   ./concurrent_bench [max threads] [pushes]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Xvector.hpp"
+#include "ConcurrentXvector.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+/**
+ * @brief Runs fn(first, last) on each of several threads, splitting
+ *        [0, total) evenly between them.
+ *
+ */
+template <typename Fn>
+void run_threads(size_t threads, size_t total, Fn fn)
+{
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; t++)
+        workers.emplace_back(fn, total * t / threads, total * (t + 1) / threads);
+    for (thread &w : workers)
+        w.join();
+}
+
+int main(int argc, char *argv[])
+{
+    size_t max_threads = argc > 1 ? strtoul(argv[1], nullptr, 10) : thread::hardware_concurrency();
+    size_t total = argc > 2 ? strtoul(argv[2], nullptr, 10) : 4000000;
+    if (max_threads < 1)
+        max_threads = 1;
+
+    printf("%zu hardware threads, %zu pushes\n", size_t(thread::hardware_concurrency()), total);
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        auto fill = [&](ConcurrentXvector<uint64_t> &v)
+        {
+            run_threads(threads, total, [&](size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; i++)
+                    v.push_back(i);
+            });
+        };
+
+        double lock_free_ns = xbench_min_ns(5, [&]
+        {
+            ConcurrentXvector<uint64_t> v;
+            fill(v);
+            do_not_optimize(v.size());
+        });
+
+        ConcurrentXvector<uint64_t> check;
+        fill(check);
+        vector<bool> seen(total); // Every value exactly once
+        bool exact = check.size() == total;
+        for (uint64_t x : check)
+        {
+            exact = exact && x < total && !seen[x];
+            if (x < total)
+                seen[x] = true;
+        }
+
+        double mutex_ns = xbench_min_ns(5, [&]
+        {
+            Xvector<uint64_t> v;
+            mutex m;
+            run_threads(threads, total, [&](size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; i++)
+                {
+                    lock_guard<mutex> guard(m);
+                    v.push_back(i);
+                }
+            });
+            do_not_optimize(v.begin());
+        });
+
+        char label[64];
+        snprintf(label, sizeof(label), "ConcurrentXvector %zu thread(s)%s", threads, exact ? "" : " MISMATCH");
+        xbench_report(label, lock_free_ns, total);
+        snprintf(label, sizeof(label), "Xvector + mutex %zu thread(s)", threads);
+        xbench_report(label, mutex_ns, total);
+        if (!exact)
+            return 1;
+    }
+}
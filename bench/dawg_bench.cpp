@@ -0,0 +1,152 @@
+/**
+ * @file dawg_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares an Xdawg of the dictionary with the string-per-word
+ *        layout, a sorted Xvector<string>: memory, membership tests, the
+ *        first 10 completions of a 3-letter prefix, every word under a
+ *        2-letter prefix, and getting a ready-to-use copy in a new process
+ *        (mapping the saved automaton against reading the text).
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. dawg_bench.cpp -o dawg_bench
+ *        Run:   ./dawg_bench [--format=table|csv|json] [--out=PATH] [--reps=N]
+ *               (reads ../dictionary.txt, writes and removes dawg_bench.xdawg)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include "Xvector.hpp"
+#include "XmappedFile.hpp"
+#include "Xdawg.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+const char *dawg_path = "dawg_bench.xdawg";
+
+/**
+ * @brief Calls fn for up to limit words of a sorted list starting with
+ *        prefix, the way the string-per-word layout answers a prefix query.
+ *
+ */
+template <typename Fn>
+size_t vector_prefixed(const Xvector<string> &words, const string &prefix, Fn fn, size_t limit)
+{
+    size_t n = 0;
+    for (auto it = lower_bound(words.begin(), words.end(), prefix);
+         it != words.end() && n < limit && it->compare(0, prefix.size(), prefix) == 0; ++it, ++n)
+        fn(string_view(*it));
+    return n;
+}
+
+int main(int argc, char *argv[])
+{
+    if (FILE *existing = fopen(dawg_path, "rb"))
+    {
+        fclose(existing);
+        fprintf(stderr, "%s exists, remove it or run from another directory\n", dawg_path);
+        return 1;
+    }
+    Xbench bench(argc, argv);
+    XmappedFile file("../dictionary.txt");
+    Xvector<string_view> lines;
+    split_lines(file.view(), lines);
+    Xvector<string> words(lines.begin(), lines.end());
+
+    Xdawg dawg;
+    dawg.build(words.begin(), words.end());
+    dawg.save(dawg_path);
+
+    size_t string_bytes = words.capacity() * sizeof(string);
+    for (const string &w : words)
+        if (w.capacity() > 15) // Past libstdc++'s in-place buffer, the characters take a heap block
+            string_bytes += w.capacity() + 1;
+    printf("%zu words: Xvector<string> %zu bytes, Xdawg %zu bytes (%zu edges), %.1fx smaller\n", words.size(),
+           string_bytes, dawg.memory_bytes(), dawg.edges_size(), double(string_bytes) / dawg.memory_bytes());
+
+    mt19937 rng(42);
+    Xvector<string> hits(words.begin(), words.end());
+    shuffle(hits.begin(), hits.end(), rng);
+    Xvector<string> misses;
+    Xvector<string> short_prefixes;
+    Xvector<string> long_prefixes;
+    for (const string &w : hits)
+    {
+        string typo(w);
+        if (!typo.empty())
+            typo[rng() % typo.size()] = static_cast<char>('a' + rng() % 26);
+        misses.push_back(typo);
+        short_prefixes.push_back(w.substr(0, 2));
+        long_prefixes.push_back(w.substr(0, 3));
+    }
+
+    bench.run("build", "Xdawg", "string", words.size(), [&]
+    {
+        Xdawg built;
+        built.build(words.begin(), words.end());
+        do_not_optimize(built.size());
+    });
+    bench.run("ready", "Xdawg load", "string", words.size(), [&]
+    {
+        Xdawg loaded;
+        do_not_optimize(loaded.load(dawg_path, false) && loaded.contains("zebra"));
+    });
+    bench.run("ready", "Xvector", "string", words.size(), [&]
+    {
+        XmappedFile text("../dictionary.txt");
+        Xvector<string_view> split;
+        split_lines(text.view(), split);
+        Xvector<string> copy(split.begin(), split.end());
+        do_not_optimize(copy.size());
+    });
+
+    size_t found = 0;
+    for (const Xvector<string> *queries : {&hits, &misses})
+    {
+        const char *op = queries == &hits ? "contains hit" : "contains miss";
+        bench.run(op, "Xdawg", "string", queries->size(), [&]
+        {
+            for (const string &q : *queries)
+                found += dawg.contains(q);
+        });
+        bench.run(op, "Xvector", "string", queries->size(), [&]
+        {
+            for (const string &q : *queries)
+                found += binary_search(words.begin(), words.end(), q);
+        });
+    }
+
+    size_t letters = 0;
+    auto count = [&](string_view s) { letters += s.size(); };
+    bench.run("first 10 of 3", "Xdawg", "string", long_prefixes.size(), [&]
+    {
+        for (const string &p : long_prefixes)
+            found += dawg.for_each_prefixed(p, count, 10);
+    });
+    bench.run("first 10 of 3", "Xvector", "string", long_prefixes.size(), [&]
+    {
+        for (const string &p : long_prefixes)
+            found += vector_prefixed(words, p, count, 10);
+    });
+    size_t sampled = 2000; // Full enumerations are long; a sample of prefixes is enough
+    bench.run("all of 2", "Xdawg", "string", sampled, [&]
+    {
+        for (size_t i = 0; i < sampled; i++)
+            found += dawg.for_each_prefixed(short_prefixes[i], count);
+    });
+    bench.run("all of 2", "Xvector", "string", sampled, [&]
+    {
+        for (size_t i = 0; i < sampled; i++)
+            found += vector_prefixed(words, short_prefixes[i], count, SIZE_MAX);
+    });
+
+    do_not_optimize(found + letters);
+    remove(dawg_path);
+    return bench.write() ? 0 : 1;
+}
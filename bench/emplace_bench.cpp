@@ -0,0 +1,83 @@
+/**
+ * @file emplace_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares Xvector::emplace_back with push_back of a temporary, for
+ *        strings built from the dictionary and for a 64-byte POD.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. emplace_bench.cpp -o emplace_bench
+ *        Run:   ./emplace_bench [path to dictionary.txt]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Xvector.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+struct Pod64
+{
+    uint64_t v[8];
+
+    Pod64(uint64_t seed)
+    {
+        for (size_t i = 0; i < 8; i++)
+            v[i] = seed + i;
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "../dictionary.txt";
+    ifstream infile(path);
+    vector<string> source;
+    string word;
+    while (infile >> word)
+        source.push_back(word);
+    if (source.empty())
+    {
+        fprintf(stderr, "could not read words from %s\n", path);
+        return 1;
+    }
+
+    const size_t reps = 20;
+    const size_t n = source.size();
+
+    xbench_report("string push_back(string(p, n))", xbench_min_ns(reps, [&]
+    {
+        Xvector<string> words;
+        for (const string &s : source)
+            words.push_back(string(s.data(), s.size()));
+        do_not_optimize(words.begin());
+    }), n);
+
+    xbench_report("string emplace_back(p, n)", xbench_min_ns(reps, [&]
+    {
+        Xvector<string> words;
+        for (const string &s : source)
+            words.emplace_back(s.data(), s.size());
+        do_not_optimize(words.begin());
+    }), n);
+
+    xbench_report("Pod64 push_back(Pod64(i))", xbench_min_ns(reps, [&]
+    {
+        Xvector<Pod64> pods;
+        for (size_t i = 0; i < n; i++)
+            pods.push_back(Pod64(i));
+        do_not_optimize(pods.begin());
+    }), n);
+
+    xbench_report("Pod64 emplace_back(i)", xbench_min_ns(reps, [&]
+    {
+        Xvector<Pod64> pods;
+        for (size_t i = 0; i < n; i++)
+            pods.emplace_back(i);
+        do_not_optimize(pods.begin());
+    }), n);
+}
@@ -0,0 +1,133 @@
+/**
+ * @file growth_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Measures load time and peak RSS of Xvector under each growth policy,
+ *        and with an up-front reserve(). Every case runs in a fresh process
+ *        so its peak RSS is not polluted by the previous one.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. growth_bench.cpp -o growth_bench
+ *        Run:   ./growth_bench [path to dictionary.txt]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "Xvector.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+const size_t int_count = 50000000; // 400 MB of uint64_t
+const size_t word_repeat = 8;      // Dictionary loaded this many times over
+
+/**
+ * @brief Returns the peak resident set size of this process in MiB.
+ *
+ * @return double
+ */
+double peak_rss_mib()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0; // ru_maxrss is in KiB on Linux
+}
+
+template <typename Growth>
+void load_ints(const char *name, bool reserve_first)
+{
+    auto start = chrono::steady_clock::now();
+    Xvector<uint64_t, allocator<uint64_t>, Growth> v;
+    if (reserve_first)
+        v.reserve(int_count);
+    for (size_t i = 0; i < int_count; i++)
+        v.push_back(i);
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    do_not_optimize(v.begin());
+    printf("%-28s %-8s %10.2f ms %10.1f MiB peak %12zu cap\n", "uint64_t x 50M", name, ms, peak_rss_mib(), v.capacity());
+}
+
+template <typename Growth>
+void load_words(const char *path, const char *name, bool reserve_first)
+{
+    string word;
+    size_t lines = 0;
+    if (reserve_first) // A loader that knows its line count up front
+    {
+        ifstream counter(path);
+        while (getline(counter, word))
+            lines++;
+    }
+
+    auto start = chrono::steady_clock::now();
+    Xvector<string, allocator<string>, Growth> v;
+    if (reserve_first)
+        v.reserve(lines * word_repeat);
+    for (size_t r = 0; r < word_repeat; r++)
+    {
+        ifstream infile(path);
+        while (infile >> word)
+            v.emplace_back(word);
+    }
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    do_not_optimize(v.begin());
+    printf("%-28s %-8s %10.2f ms %10.1f MiB peak %12zu cap\n", "dictionary strings x 8", name, ms, peak_rss_mib(), v.capacity());
+}
+
+/**
+ * @brief Runs one case in this process.
+ *
+ * @param which Name of the case.
+ * @param path Path to dictionary.txt.
+ */
+void run_case(const string &which, const char *path)
+{
+    if (which == "ints-2x")
+        load_ints<xvector_growth_double>("2x", false);
+    else if (which == "ints-1.5x")
+        load_ints<xvector_growth_half>("1.5x", false);
+    else if (which == "ints-page")
+        load_ints<xvector_growth_page_rounded<>>("page", false);
+    else if (which == "ints-reserve")
+        load_ints<xvector_growth_double>("reserve", true);
+    else if (which == "words-2x")
+        load_words<xvector_growth_double>(path, "2x", false);
+    else if (which == "words-1.5x")
+        load_words<xvector_growth_half>(path, "1.5x", false);
+    else if (which == "words-page")
+        load_words<xvector_growth_page_rounded<>>(path, "page", false);
+    else if (which == "words-reserve")
+        load_words<xvector_growth_double>(path, "reserve", true);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "../dictionary.txt";
+    if (argc > 2) // Child process: run a single case
+    {
+        run_case(argv[2], path);
+        return 0;
+    }
+
+    const char *cases[] = {"ints-2x", "ints-1.5x", "ints-page", "ints-reserve",
+                           "words-2x", "words-1.5x", "words-page", "words-reserve"};
+    for (const char *c : cases)
+    {
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            execl("/proc/self/exe", argv[0], path, c, static_cast<char *>(nullptr));
+            _exit(127);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+    }
+}
@@ -0,0 +1,97 @@
+/**
+ * @file hash_index_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Times membership lookups on a word list: an XhashIndex over the
+ *        list, a std::unordered_set of string_views into it, and the linear
+ *        scan that was the only option before. Hits look up every word in
+ *        shuffled order; misses look up each word with its last letter
+ *        changed, keeping only results that are not words, like typos sent
+ *        to a spell checker.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. hash_index_bench.cpp -o hash_index_bench
+ *        Run:   ./hash_index_bench [--format=table|csv|json] [--out=PATH] [--reps=N]
+ *               (reads ../dictionary.txt)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include "Xvector.hpp"
+#include "XmappedFile.hpp"
+#include "XhashIndex.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+const size_t scanned = 500; // Queries timed for the linear scan, which is too slow for all of them
+
+int main(int argc, char *argv[])
+{
+    Xbench bench(argc, argv);
+    XmappedFile file("../dictionary.txt");
+    Xvector<string_view> words;
+    split_lines(file.view(), words);
+
+    XhashIndex<Xvector<string_view>> index(words);
+    unordered_set<string_view> std_set(words.begin(), words.end());
+
+    Xvector<string_view> hits(words);
+    shuffle(hits.begin(), hits.end(), mt19937(42));
+
+    Xvector<string> typos; // Owns the strings the misses view
+    for (string_view w : words)
+    {
+        string typo(w);
+        if (typo.empty())
+            continue;
+        typo.back() = typo.back() == 'z' ? 'a' : typo.back() + 1;
+        if (!std_set.count(typo))
+            typos.push_back(typo);
+    }
+    Xvector<string_view> misses(typos.begin(), typos.end());
+    shuffle(misses.begin(), misses.end(), mt19937(43));
+
+    printf("%zu words, %zu misses, index of %zu slots in %zu bytes\n", words.size(), misses.size(),
+           index.capacity(), index.memory_bytes());
+
+    bench.run("build", "XhashIndex", "string", words.size(), [&]
+    {
+        XhashIndex<Xvector<string_view>> built(words);
+        do_not_optimize(built.size());
+    });
+    bench.run("build", "unordered_set", "string", words.size(), [&]
+    {
+        unordered_set<string_view> built(words.begin(), words.end());
+        do_not_optimize(built.size());
+    });
+
+    size_t found = 0;
+    for (const Xvector<string_view> *queries : {&hits, &misses})
+    {
+        const char *op = queries == &hits ? "hit" : "miss";
+        bench.run(op, "XhashIndex", "string", queries->size(), [&]
+        {
+            for (string_view q : *queries)
+                found += index.contains(q);
+        });
+        bench.run(op, "unordered_set", "string", queries->size(), [&]
+        {
+            for (string_view q : *queries)
+                found += std_set.count(q);
+        });
+        bench.run(op, "linear scan", "string", scanned, [&]
+        {
+            for (size_t i = 0; i < scanned; i++)
+                found += find(words.begin(), words.end(), (*queries)[i]) != words.end();
+        });
+    }
+    do_not_optimize(found);
+    return bench.write() ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file mapped_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Shows that reopening a MappedXvector takes the same time whatever
+ *        its size, unlike reading the same doubles into an Xvector. For each
+ *        size, a file of word-length features is written once, then both ways
+ *        of getting it back are timed up to the first and last element.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. mapped_bench.cpp -o mapped_bench
+ *        Run:   ./mapped_bench [scratch file path, default mapped_bench.bin]
+ *               (the scratch file must not exist yet; it is removed at the end)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include "Xvector.hpp"
+#include "MappedXvector.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "mapped_bench.bin";
+    if (FILE *existing = fopen(path, "rb"))
+    {
+        fclose(existing);
+        fprintf(stderr, "%s exists, remove it or pass a path the bench may create\n", path);
+        return 1;
+    }
+
+    for (size_t n = 1 << 20; n <= size_t(1) << 26; n <<= 2)
+    {
+        remove(path);
+        {
+            MappedXvector<double> v(path);
+            v.reserve(n);
+            for (size_t i = 0; i < n; i++)
+                v.push_back(static_cast<double>(i % 23 + 1)); // Stand-in for a per-word feature
+        }
+
+        double open_ns = xbench_min_ns(5, [&]
+        {
+            MappedXvector<double> v(path);
+            do_not_optimize(v[0] + v[v.size() - 1]);
+        });
+
+        double read_ns = xbench_min_ns(5, [&]
+        {
+            FILE *f = fopen(path, "rb");
+            if (!f)
+                return;
+            fseek(f, 64, SEEK_SET); // Skip the header
+            Xvector<double> v;
+            v.resize_for_overwrite(n);
+            size_t got = fread(v.begin(), sizeof(double), n, f);
+            fclose(f);
+            do_not_optimize(v[0] + v[got - 1]);
+        });
+
+        printf("%10zu doubles   reopen MappedXvector %10.3f ms   fread into Xvector %10.3f ms\n", n, open_ns / 1e6,
+               read_ns / 1e6);
+    }
+    remove(path);
+}
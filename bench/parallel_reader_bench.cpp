@@ -0,0 +1,74 @@
+/**
+ * @file parallel_reader_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Measures how split_lines_parallel scales from 1 to N threads and
+ *        checks that every thread count yields exactly the lines of the
+ *        single-threaded split_lines, in order, also into vectors backed
+ *        by a shared Xarena and by the calling thread's arena.
+ *
+ *        Build: g++ -std=c++17 -O2 -pthread -I.. parallel_reader_bench.cpp -o parallel_reader_bench
+ *        Run:   ./parallel_reader_bench [path to word list] [max threads]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+#include "Xvector.hpp"
+#include "Xarena.hpp"
+#include "XmappedFile.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "../dictionary.txt";
+    size_t max_threads = argc > 2 ? strtoul(argv[2], nullptr, 10) : thread::hardware_concurrency();
+    if (max_threads < 1)
+        max_threads = 1;
+
+    XmappedFile file(path);
+    Xvector<string_view> expected;
+    split_lines(file.view(), expected);
+
+    printf("%zu hardware threads, %zu lines, %zu bytes\n", size_t(thread::hardware_concurrency()), expected.size(),
+           file.size());
+    double base = 0;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        double ns = xbench_min_ns(5, [&]
+        {
+            Xvector<string_view> lines;
+            split_lines_parallel(file.view(), lines, threads);
+            do_not_optimize(lines.begin());
+        });
+
+        auto matches = [&](const auto &lines)
+        {
+            bool same = lines.size() == expected.size();
+            for (size_t i = 0; same && i < lines.size(); i++)
+                same = lines[i].data() == expected[i].data() && lines[i].size() == expected[i].size();
+            return same;
+        };
+        Xvector<string_view> lines;
+        split_lines_parallel(file.view(), lines, threads);
+        Xarena arena;
+        Xvector<string_view, xarena_allocator<string_view>> arena_lines{xarena_allocator<string_view>(arena)};
+        split_lines_parallel(file.view(), arena_lines, threads);
+        Xvector<string_view, xarena_thread_allocator<string_view>> thread_lines;
+        split_lines_parallel(file.view(), thread_lines, threads);
+        bool same = matches(lines) && matches(arena_lines) && matches(thread_lines);
+
+        if (threads == 1)
+            base = ns;
+        char label[64];
+        snprintf(label, sizeof(label), "%zu thread(s)%s", threads, same ? "" : " MISMATCH");
+        printf("%-24s %10.3f ms %8.2f GB/s %6.2fx\n", label, ns / 1e6, file.size() / ns, base / ns);
+        if (!same)
+            return 1;
+    }
+}
@@ -0,0 +1,85 @@
+/**
+ * @file read_buffer_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares preparing an Xvector<char> read buffer with resize, which
+ *        zero-fills it, against resize_for_overwrite, which does not. Each
+ *        case sizes a fresh buffer and then overwrites all of it, once with
+ *        memset as a stand-in for a large read and once with fread of a file.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. read_buffer_bench.cpp -o read_buffer_bench
+ *        Run:   ./read_buffer_bench [path to file] [buffer MiB]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "Xvector.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+/**
+ * @brief Reads a whole file into a buffer sized up front.
+ *
+ */
+template <bool Overwrite>
+size_t read_file(const char *path, size_t file_bytes)
+{
+    Xvector<char> buffer;
+    if (Overwrite)
+        buffer.resize_for_overwrite(file_bytes);
+    else
+        buffer.resize(file_bytes);
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return 0;
+    size_t n = fread(buffer.begin(), 1, buffer.size(), f);
+    fclose(f);
+    do_not_optimize(buffer.begin());
+    return n;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "../dictionary.txt";
+    size_t mib = argc > 2 ? strtoul(argv[2], nullptr, 10) : 256;
+    size_t bytes = mib << 20;
+
+    double zeroed_ns = xbench_min_ns(5, [&]
+    {
+        Xvector<char> buffer;
+        buffer.resize(bytes);
+        memset(buffer.begin(), 'x', bytes);
+        do_not_optimize(buffer.begin());
+    });
+
+    double raw_ns = xbench_min_ns(5, [&]
+    {
+        Xvector<char> buffer;
+        buffer.resize_for_overwrite(bytes);
+        memset(buffer.begin(), 'x', bytes);
+        do_not_optimize(buffer.begin());
+    });
+
+    FILE *f = fopen(path, "rb");
+    if (!f)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    size_t file_bytes = static_cast<size_t>(ftell(f));
+    fclose(f);
+
+    double read_zeroed_ns = xbench_min_ns(5, [&] { read_file<false>(path, file_bytes); });
+    double read_raw_ns = xbench_min_ns(5, [&] { read_file<true>(path, file_bytes); });
+
+    xbench_report("resize + fill", zeroed_ns, bytes);
+    xbench_report("resize_for_overwrite + fill", raw_ns, bytes);
+    xbench_report("resize + fread", read_zeroed_ns, file_bytes);
+    xbench_report("resize_for_overwrite + fread", read_raw_ns, file_bytes);
+}
@@ -0,0 +1,53 @@
+/**
+ * @file reader_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares loading a word list with ifstream >> word against mapping
+ *        it with XmappedFile and splitting it into string_views.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. reader_bench.cpp -o reader_bench
+ *        Run:   ./reader_bench [path to word list]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include "Xvector.hpp"
+#include "XstringVector.hpp"
+#include "XmappedFile.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "../dictionary.txt";
+    size_t file_bytes = XmappedFile(path).size();
+    size_t words = 0;
+
+    double stream_ns = xbench_min_ns(5, [&]
+    {
+        ifstream infile(path);
+        XstringVector<size_t> pool;
+        string word;
+        while (infile >> word)
+            pool.push_back(word);
+        words = pool.size();
+        do_not_optimize(pool.buffer());
+    });
+
+    double mapped_ns = xbench_min_ns(5, [&]
+    {
+        XmappedFile file(path);
+        Xvector<string_view> lines;
+        split_lines(file.view(), lines);
+        do_not_optimize(lines.begin());
+    });
+
+    xbench_report("ifstream >> word", stream_ns, words);
+    xbench_report("XmappedFile + split_lines", mapped_ns, words);
+    printf("%-40s %8.2f GB/s vs %8.2f GB/s\n", "throughput", file_bytes / stream_ns, file_bytes / mapped_ns);
+}
@@ -0,0 +1,158 @@
+/**
+ * @file set_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares the Xset operations with the std algorithms writing
+ *        through a back_inserter, and with combining word lists in a
+ *        std::set: union, intersection and difference of two overlapping
+ *        halves of the dictionary, an intersection of 1000 words with the
+ *        whole dictionary (galloping), unique on a merged list, and an
+ *        intersection of two sets of 1M integer IDs on each instruction set.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. set_bench.cpp -o set_bench
+ *        Run:   ./set_bench [--format=table|csv|json] [--out=PATH] [--reps=N]
+ *               (reads ../dictionary.txt, which is sorted)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Xvector.hpp"
+#include "XmappedFile.hpp"
+#include "Xsimd.hpp"
+#include "Xset.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    Xbench bench(argc, argv);
+    XmappedFile file("../dictionary.txt");
+    Xvector<string_view> lines;
+    split_lines(file.view(), lines);
+    Xvector<string> words(lines.begin(), lines.end());
+    if (!is_sorted(words.begin(), words.end()))
+    {
+        fprintf(stderr, "dictionary.txt is not sorted\n");
+        return 1;
+    }
+
+    mt19937 rng(42);
+    Xvector<string> first_list; // Two lists of about 60% of the words each, overlapping in about 36%
+    Xvector<string> second_list;
+    Xvector<string> few;        // 1000 words, for the skewed intersection
+    for (const string &w : words)
+    {
+        if (rng() % 10 < 6)
+            first_list.push_back(w);
+        if (rng() % 10 < 6)
+            second_list.push_back(w);
+        if (rng() % words.size() < 1000)
+            few.push_back(w);
+    }
+    Xvector<string> merged(first_list.begin(), first_list.end());
+    merged.append_range(second_list.begin(), second_list.end());
+    sort(merged.begin(), merged.end());
+    printf("lists of %zu and %zu words, %zu in the skewed list\n", first_list.size(), second_list.size(), few.size());
+
+    Xvector<string> out;
+    vector<string> std_out;
+    size_t items = first_list.size() + second_list.size();
+    bench.run("union", "Xset", "string", items, [&] { xset_union(first_list, second_list, out); });
+    bench.run("union", "std", "string", items, [&]
+    {
+        std_out.clear();
+        set_union(first_list.begin(), first_list.end(), second_list.begin(), second_list.end(), back_inserter(std_out));
+    });
+    bench.run("union", "std::set", "string", items, [&]
+    {
+        set<string> combined(first_list.begin(), first_list.end());
+        combined.insert(second_list.begin(), second_list.end());
+        do_not_optimize(combined.size());
+    });
+    bench.run("unite in place", "Xset", "string", items, [&]
+    {
+        Xvector<string> unite(first_list.begin(), first_list.end());
+        xset_unite(unite, second_list);
+        do_not_optimize(unite.size());
+    });
+
+    bench.run("intersection", "Xset", "string", items, [&] { xset_intersection(first_list, second_list, out); });
+    bench.run("intersection", "std", "string", items, [&]
+    {
+        std_out.clear();
+        set_intersection(first_list.begin(), first_list.end(), second_list.begin(), second_list.end(),
+                         back_inserter(std_out));
+    });
+    bench.run("difference", "Xset", "string", items, [&] { xset_difference(first_list, second_list, out); });
+    bench.run("difference", "std", "string", items, [&]
+    {
+        std_out.clear();
+        set_difference(first_list.begin(), first_list.end(), second_list.begin(), second_list.end(),
+                       back_inserter(std_out));
+    });
+
+    items = few.size() + words.size();
+    bench.run("skewed intersection", "Xset", "string", items, [&] { xset_intersection(few, words, out); });
+    bench.run("skewed intersection", "std", "string", items, [&]
+    {
+        std_out.clear();
+        set_intersection(few.begin(), few.end(), words.begin(), words.end(), back_inserter(std_out));
+    });
+
+    Xvector<string> deduped;
+    bench.run("unique", "Xset", "string", merged.size(), [&]
+    {
+        deduped.resize(0);
+        deduped.append_range(merged.begin(), merged.end());
+        xset_unique(deduped);
+    });
+    bench.run("unique", "std", "string", merged.size(), [&]
+    {
+        deduped.resize(0);
+        deduped.append_range(merged.begin(), merged.end());
+        deduped.erase(unique(deduped.begin(), deduped.end()), deduped.end());
+    });
+
+    Xvector<uint32_t> all_ids; // About 1M of 4M IDs each, about 250K in both
+    Xvector<uint32_t> some_ids;
+    for (uint32_t id = 0; id < 4000000; id++)
+    {
+        if (rng() % 4 == 0)
+            all_ids.push_back(id);
+        if (rng() % 4 == 0)
+            some_ids.push_back(id);
+    }
+    Xvector<uint32_t> id_out;
+    vector<uint32_t> std_ids;
+    items = all_ids.size() + some_ids.size();
+    xsimd_isa detected = xsimd_active();
+    const char *levels[] = {"Xset scalar", "Xset SSE2"};
+    for (xsimd_isa isa : {xsimd_isa::scalar, xsimd_isa::sse2})
+    {
+        if (isa > detected)
+            continue;
+        xsimd_active() = isa;
+        bench.run("id intersection", levels[static_cast<int>(isa)], "uint32_t", items,
+                  [&] { xset_intersection(all_ids, some_ids, id_out); });
+    }
+    xsimd_active() = detected;
+    bench.run("id intersection", "std", "uint32_t", items, [&]
+    {
+        std_ids.clear();
+        set_intersection(all_ids.begin(), all_ids.end(), some_ids.begin(), some_ids.end(), back_inserter(std_ids));
+    });
+
+    do_not_optimize(out.size() + std_out.size() + deduped.size() + id_out.size() + std_ids.size());
+    return bench.write() ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file simd_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares the Xsimd kernels, forced to each instruction set the CPU
+ *        supports, with the plain loops a caller would otherwise write over
+ *        an Xvector. Build it at -O2 and -O3 to see what the compiler's own
+ *        vectorizer achieves on the plain loops: it does not reassociate
+ *        floating-point sums, and at -O2 targets only the baseline.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. simd_bench.cpp -o simd_bench
+ *               g++ -std=c++17 -O3 -I.. simd_bench.cpp -o simd_bench_o3
+ *        Run:   ./simd_bench [--format=table|csv|json] [--out=PATH] [--reps=N]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <string>
+#include "Xvector.hpp"
+#include "Xarray.hpp"
+#include "Xsimd.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+const size_t n = 1 << 11;   // Elements per array, small enough for the arrays to stay in L1
+const size_t passes = 256; // Passes over the array per timed run
+
+/**
+ * @brief Times every operation on arrays of T with plain loops, then with
+ *        the Xsimd kernels at each instruction set up to the detected one.
+ *
+ */
+template <typename T>
+void bench_type(Xbench &bench, const string &type)
+{
+    Xvector<T> a, b, out;
+    for (size_t i = 0; i < n; i++)
+    {
+        a.push_back(static_cast<T>(i % 251) - 125);
+        b.push_back(static_cast<T>(i % 13) - 6);
+    }
+    out.resize(n);
+    size_t items = n * passes;
+
+    bench.run("sum", "plain loop", type, items, [&]
+    {
+        for (size_t p = 0; p < passes; p++)
+        {
+            T sum = 0;
+            for (T x : a)
+                sum += x;
+            do_not_optimize(sum);
+        }
+    });
+    bench.run("min", "plain loop", type, items, [&]
+    {
+        for (size_t p = 0; p < passes; p++)
+        {
+            T best = a[0];
+            for (T x : a)
+                best = x < best ? x : best;
+            do_not_optimize(best);
+        }
+    });
+    bench.run("dot", "plain loop", type, items, [&]
+    {
+        for (size_t p = 0; p < passes; p++)
+        {
+            T sum = 0;
+            for (size_t i = 0; i < n; i++)
+                sum += a[i] * b[i];
+            do_not_optimize(sum);
+        }
+    });
+    bench.run("transform", "plain loop", type, items, [&]
+    {
+        for (size_t p = 0; p < passes; p++)
+        {
+            for (size_t i = 0; i < n; i++)
+                out[i] = a[i] * 3 + 1;
+            do_not_optimize(out.begin());
+        }
+    });
+
+    xsimd_isa detected = xsimd_detect();
+    const char *names[] = {"xsimd scalar", "xsimd sse2", "xsimd avx2"};
+    for (xsimd_isa isa : {xsimd_isa::scalar, xsimd_isa::sse2, xsimd_isa::avx2})
+    {
+        if (isa > detected)
+            break;
+        xsimd_active() = isa;
+        const char *name = names[static_cast<int>(isa)];
+        bench.run("sum", name, type, items, [&]
+        {
+            for (size_t p = 0; p < passes; p++)
+                do_not_optimize(xsimd_sum(a.begin(), a.end()));
+        });
+        bench.run("min", name, type, items, [&]
+        {
+            for (size_t p = 0; p < passes; p++)
+                do_not_optimize(xsimd_min(a.begin(), a.end()));
+        });
+        bench.run("dot", name, type, items, [&]
+        {
+            for (size_t p = 0; p < passes; p++)
+                do_not_optimize(xsimd_dot(a.begin(), a.end(), b.begin()));
+        });
+        bench.run("transform", name, type, items, [&]
+        {
+            for (size_t p = 0; p < passes; p++)
+                do_not_optimize(xsimd_transform(a.begin(), a.end(), out.begin(), [](T x) { return x * 3 + 1; }));
+        });
+    }
+    xsimd_active() = detected;
+}
+
+int main(int argc, char *argv[])
+{
+    Xbench bench(argc, argv);
+    bench_type<float>(bench, "float");
+    bench_type<double>(bench, "double");
+    bench_type<int32_t>(bench, "int32");
+
+    static Xarray<float, 1024> small; // Fixed-size arrays work the same way
+    for (size_t i = 0; i < small.size(); i++)
+        small[i] = static_cast<float>(i % 7);
+    bench.run("sum", "Xarray xsimd", "float", small.size() * passes, [&]
+    {
+        for (size_t p = 0; p < passes; p++)
+            do_not_optimize(xsimd_sum(small.cbegin(), small.cend()));
+    });
+    return bench.write() ? 0 : 1;
+}
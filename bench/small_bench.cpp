@@ -0,0 +1,85 @@
+/**
+ * @file small_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Builds and drops many short-lived vectors of 1 to 32 elements and
+ *        reports latency and allocator calls per vector for Xvector and
+ *        SmallXvector<T, 16>.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. small_bench.cpp -o small_bench
+ *        Run:   ./small_bench
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string>
+#include "Xvector.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+size_t allocation_count = 0;
+
+/**
+ * @brief std::allocator that counts calls to allocate().
+ *
+ * @tparam T type of element.
+ */
+template <typename T>
+struct counting_allocator : allocator<T>
+{
+    template <typename U>
+    struct rebind
+    {
+        using other = counting_allocator<U>;
+    };
+
+    counting_allocator() {}
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U> &) {}
+
+    T *allocate(size_t n)
+    {
+        allocation_count++;
+        return allocator<T>::allocate(n);
+    }
+};
+
+template <typename Vec, typename T>
+void run(const char *name, size_t elems, const T &value)
+{
+    const size_t vectors = 200000;
+    allocation_count = 0;
+    double ns = xbench_min_ns(5, [&]
+    {
+        for (size_t i = 0; i < vectors; i++)
+        {
+            Vec v;
+            for (size_t j = 0; j < elems; j++)
+                v.push_back(value);
+            do_not_optimize(v.begin());
+        }
+    });
+    char label[64];
+    snprintf(label, sizeof(label), "%s x%zu", name, elems);
+    printf("%-40s %10.2f ns/vector %8.2f allocs/vector\n", label, ns / vectors,
+           double(allocation_count) / (5 * vectors));
+}
+
+int main()
+{
+    const size_t sizes[] = {1, 4, 8, 16, 32};
+    for (size_t n : sizes)
+    {
+        run<Xvector<int, counting_allocator<int>>>("Xvector<int>", n, 42);
+        run<SmallXvector<int, 16, counting_allocator<int>>>("SmallXvector<int, 16>", n, 42);
+    }
+    const string word = "dictionary";
+    for (size_t n : sizes)
+    {
+        run<Xvector<string, counting_allocator<string>>>("Xvector<string>", n, word);
+        run<SmallXvector<string, 16, counting_allocator<string>>>("SmallXvector<string, 16>", n, word);
+    }
+}
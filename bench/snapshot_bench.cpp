@@ -0,0 +1,85 @@
+/**
+ * @file snapshot_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares getting a word list ready from its text (map and split
+ *        into lines) with loading an Xsnapshot of it, with and without
+ *        checksum verification. A repeat count builds larger lists by
+ *        repeating the dictionary.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. snapshot_bench.cpp -o snapshot_bench
+ *        Run:   ./snapshot_bench [path to word list] [repeat] [scratch snapshot path, must not exist yet]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include "Xvector.hpp"
+#include "XmappedFile.hpp"
+#include "Xsnapshot.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "../dictionary.txt";
+    size_t repeat = argc > 2 ? strtoul(argv[2], nullptr, 10) : 1;
+    bool default_snap = argc <= 3;
+    const char *snap_path = default_snap ? "snapshot_bench.xsnap" : argv[3];
+    if (FILE *existing = default_snap ? nullptr : fopen(snap_path, "rb"))
+    {
+        fclose(existing);
+        fprintf(stderr, "%s exists, pass a path the bench may create\n", snap_path);
+        return 1;
+    }
+    if (repeat < 1)
+        repeat = 1;
+
+    XmappedFile file(path);
+    Xvector<string_view> words;
+    split_lines(file.view(), words);
+    size_t once = words.size();
+    words.reserve(once * repeat);
+    for (size_t r = 1; r < repeat; r++)
+        words.append(words.begin(), once);
+    xsnapshot_save(snap_path, words.begin(), words.end(), 42);
+    printf("%zu words, snapshot of %zu bytes\n", words.size(), XmappedFile(snap_path).size());
+
+    double parse_ns = xbench_min_ns(5, [&]
+    {
+        XmappedFile text(path);
+        Xvector<string_view> lines;
+        for (size_t r = 0; r < repeat; r++) // The same text, split as often as the list repeats it
+            split_lines(text.view(), lines);
+        do_not_optimize(lines[lines.size() - 1].data());
+    });
+
+    bool loaded = true;
+    double verified_ns = xbench_min_ns(5, [&]
+    {
+        Xsnapshot snap;
+        loaded = snap.load(snap_path, 42) && loaded;
+        do_not_optimize(snap[snap.size() - 1].data());
+    });
+
+    double lazy_ns = xbench_min_ns(5, [&]
+    {
+        Xsnapshot snap;
+        loaded = snap.load(snap_path, 42, false) && loaded;
+        do_not_optimize(snap[snap.size() - 1].data());
+    });
+
+    Xsnapshot stale;
+    bool rejected = !stale.load(snap_path, 43, false);
+
+    xbench_report("map + split_lines", parse_ns, words.size());
+    xbench_report("Xsnapshot::load, verified", verified_ns, words.size());
+    xbench_report("Xsnapshot::load, unverified", lazy_ns, words.size());
+    printf("loads %s, stale tag %s\n", loaded ? "ok" : "FAILED", rejected ? "rejected" : "ACCEPTED");
+    remove(snap_path);
+    return loaded && rejected ? 0 : 1;
+}
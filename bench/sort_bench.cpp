@@ -0,0 +1,144 @@
+/**
+ * @file sort_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares xsort and xstable_sort on 1, 2, 4 and 8 threads with
+ *        std::sort and std::stable_sort, on a merged word list: 8 shuffled
+ *        copies of the dictionary, one left as is and the others with a
+ *        suffix, as Xvector<string>, as Xvector<string_view>, and as the
+ *        64-bit hashes of the words for the comparison path. Every run starts
+ *        by copying the unsorted list, the same for every row. Before timing,
+ *        checks both sorts against std::stable_sort on strings that share a
+ *        long prefix, which must not deepen the stack per shared character.
+ *
+ *        Build: g++ -std=c++17 -O2 -pthread -I.. sort_bench.cpp -o sort_bench
+ *        Run:   ./sort_bench [--format=table|csv|json] [--out=PATH] [--reps=N]
+ *               (reads ../dictionary.txt)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include "Xvector.hpp"
+#include "XmappedFile.hpp"
+#include "Xsort.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+/**
+ * @brief Times std::sort, std::stable_sort, xsort and xstable_sort on a copy
+ *        of input for each thread count.
+ *
+ */
+template <typename T>
+void sort_cases(Xbench &bench, const Xvector<T> &input, const string &type)
+{
+    Xvector<T> v;
+    v.reserve(input.size());
+    auto fresh = [&]
+    {
+        v.resize(0);
+        v.append(input.begin(), input.size());
+    };
+    bench.run("sort", "std", type, input.size(), [&]
+    {
+        fresh();
+        sort(v.begin(), v.end());
+        do_not_optimize(v[0]);
+    });
+    bench.run("stable_sort", "std", type, input.size(), [&]
+    {
+        fresh();
+        stable_sort(v.begin(), v.end());
+        do_not_optimize(v[0]);
+    });
+    for (size_t threads : {1, 2, 4, 8})
+    {
+        string name = "Xsort " + to_string(threads) + "t";
+        bench.run("sort", name, type, input.size(), [&]
+        {
+            fresh();
+            xsort(v, threads);
+            do_not_optimize(v[0]);
+        });
+        bench.run("stable_sort", name, type, input.size(), [&]
+        {
+            fresh();
+            xstable_sort(v, threads);
+            do_not_optimize(v[0]);
+        });
+    }
+}
+
+/**
+ * @brief Sorts strings that share a 4000-character prefix with xsort and
+ *        xstable_sort on 1 and 4 threads and compares them with
+ *        std::stable_sort.
+ *
+ * @return true if both match.
+ */
+bool long_prefix_check()
+{
+    mt19937 rng(7);
+    string prefix(4000, 'a');
+    Xvector<string> input;
+    for (size_t i = 0; i < 4096; i++)
+        input.push_back(prefix + to_string(rng() % 1000));
+    Xvector<string> expected(input.begin(), input.end());
+    stable_sort(expected.begin(), expected.end());
+    for (size_t threads : {1, 4})
+    {
+        Xvector<string> fast(input.begin(), input.end()), stable(input.begin(), input.end());
+        xsort(fast, threads);
+        xstable_sort(stable, threads);
+        if (!equal(fast.begin(), fast.end(), expected.begin(), expected.end()) ||
+            !equal(stable.begin(), stable.end(), expected.begin(), expected.end()))
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    Xbench bench(argc, argv);
+    if (!long_prefix_check())
+    {
+        fprintf(stderr, "sort_bench: long shared prefix sorted incorrectly\n");
+        return 1;
+    }
+    XmappedFile file("../dictionary.txt");
+    Xvector<string_view> lines;
+    split_lines(file.view(), lines);
+
+    const char *suffixes[] = {"", "s", "ed", "ing", "er", "ly", "ness", "less"};
+    mt19937 rng(42);
+    Xvector<string> words;
+    words.reserve(lines.size() * 8);
+    for (const char *suffix : suffixes)
+    {
+        size_t first = words.size();
+        for (string_view line : lines)
+            words.push_back(string(line) + suffix);
+        shuffle(words.begin() + first, words.end(), rng);
+    }
+    shuffle(words.begin(), words.end(), rng);
+    Xvector<string_view> views(words.begin(), words.end());
+    Xvector<uint64_t> hashes;
+    for (string_view w : views)
+        hashes.push_back(hash<string_view>()(w));
+    printf("%zu words, %u hardware threads\n", words.size(), thread::hardware_concurrency());
+
+    sort_cases(bench, words, "string");
+    sort_cases(bench, views, "string_view");
+    sort_cases(bench, hashes, "uint64_t");
+    return bench.write() ? 0 : 1;
+}
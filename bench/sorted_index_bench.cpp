@@ -0,0 +1,110 @@
+/**
+ * @file sorted_index_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares searches through an XsortedIndex with std::lower_bound on
+ *        the sorted Xvector<string> it indexes: lower_bound for words in
+ *        random order, lower_bound for misspelled words, equal_range, and
+ *        the range of words starting with a random 3-letter prefix.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. sorted_index_bench.cpp -o sorted_index_bench
+ *        Run:   ./sorted_index_bench [--format=table|csv|json] [--out=PATH] [--reps=N]
+ *               (reads ../dictionary.txt, which is sorted)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include "Xvector.hpp"
+#include "XmappedFile.hpp"
+#include "XsortedIndex.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    Xbench bench(argc, argv);
+    XmappedFile file("../dictionary.txt");
+    Xvector<string_view> lines;
+    split_lines(file.view(), lines);
+    Xvector<string> words(lines.begin(), lines.end());
+    if (!is_sorted(words.begin(), words.end()))
+    {
+        fprintf(stderr, "dictionary.txt is not sorted\n");
+        return 1;
+    }
+
+    XsortedIndex<Xvector<string>> index(words);
+
+    mt19937 rng(42);
+    Xvector<string> hits(words.begin(), words.end());
+    shuffle(hits.begin(), hits.end(), rng);
+    Xvector<string> typos;
+    Xvector<string> prefixes;
+    for (const string &w : hits)
+    {
+        string typo(w);
+        if (!typo.empty())
+            typo[rng() % typo.size()] = static_cast<char>('a' + rng() % 26);
+        typos.push_back(typo);
+        prefixes.push_back(w.substr(0, 3));
+    }
+    printf("%zu words, index of %zu bytes\n", words.size(), index.memory_bytes());
+
+    size_t checksum = 0;
+    bench.run("build", "XsortedIndex", "string", words.size(), [&]
+    {
+        XsortedIndex<Xvector<string>> built(words);
+        do_not_optimize(built.size());
+    });
+
+    for (const Xvector<string> *queries : {&hits, &typos})
+    {
+        const char *op = queries == &hits ? "lower_bound hit" : "lower_bound miss";
+        bench.run(op, "XsortedIndex", "string", queries->size(), [&]
+        {
+            for (const string &q : *queries)
+                checksum += index.lower_bound(q);
+        });
+        bench.run(op, "std", "string", queries->size(), [&]
+        {
+            for (const string &q : *queries)
+                checksum += lower_bound(words.begin(), words.end(), q) - words.begin();
+        });
+    }
+
+    bench.run("equal_range", "XsortedIndex", "string", hits.size(), [&]
+    {
+        for (const string &q : hits)
+            checksum += index.equal_range(q).second;
+    });
+    bench.run("equal_range", "std", "string", hits.size(), [&]
+    {
+        for (const string &q : hits)
+            checksum += equal_range(words.begin(), words.end(), q).second - words.begin();
+    });
+
+    bench.run("prefix_range", "XsortedIndex", "string", prefixes.size(), [&]
+    {
+        for (const string &q : prefixes)
+            checksum += index.prefix_range(q).second;
+    });
+    bench.run("prefix_range", "std", "string", prefixes.size(), [&]
+    {
+        for (const string &q : prefixes)
+        {
+            auto first = lower_bound(words.begin(), words.end(), q);
+            auto last = partition_point(first, words.end(), [&](const string &w) { return w.compare(0, q.size(), q) == 0; });
+            checksum += last - words.begin();
+        }
+    });
+
+    do_not_optimize(checksum);
+    return bench.write() ? 0 : 1;
+}
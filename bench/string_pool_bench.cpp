@@ -0,0 +1,79 @@
+/**
+ * @file string_pool_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares the memory footprint and full-scan time of the dictionary
+ *        held as Xvector<string> and as XstringVector.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. string_pool_bench.cpp -o string_pool_bench
+ *        Run:   ./string_pool_bench [path to dictionary.txt]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Xvector.hpp"
+#include "XstringVector.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+/**
+ * @brief Counts the characters 'e' in every word, touching every byte.
+ *
+ * @tparam Container type of word container.
+ * @param words Words to scan.
+ * @return size_t
+ */
+template <typename Container>
+size_t count_e(const Container &words)
+{
+    size_t count = 0;
+    for (auto &&w : words)
+        for (char c : w)
+            count += c == 'e';
+    return count;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "../dictionary.txt";
+    ifstream infile(path);
+    vector<string> source;
+    string word;
+    while (infile >> word)
+        source.push_back(word);
+    if (source.empty())
+    {
+        fprintf(stderr, "could not read words from %s\n", path);
+        return 1;
+    }
+
+    Xvector<string> strings;
+    for (const string &s : source)
+        strings.push_back(s);
+    strings.shrink_to_fit();
+    size_t string_bytes = strings.capacity() * sizeof(string);
+    for (const string &s : strings)
+        if (s.capacity() > 15) // Longer than the small-string buffer: one heap block
+            string_bytes += s.capacity() + 1;
+
+    XstringVector<> pool;
+    for (const string &s : source)
+        pool.push_back(s);
+    pool.shrink_to_fit();
+
+    printf("%-28s %10zu bytes (%5.1f bytes/word)\n", "Xvector<string>", string_bytes,
+           double(string_bytes) / source.size());
+    printf("%-28s %10zu bytes (%5.1f bytes/word)\n", "XstringVector<>", pool.memory_usage(),
+           double(pool.memory_usage()) / source.size());
+
+    size_t total = 0;
+    for (const string &s : source)
+        total += s.size();
+    xbench_report("scan Xvector<string>", xbench_min_ns(50, [&] { do_not_optimize(count_e(strings)); }), total);
+    xbench_report("scan XstringVector<>", xbench_min_ns(50, [&] { do_not_optimize(count_e(pool)); }), total);
+}
@@ -0,0 +1,54 @@
+/**
+ * @file writer_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Compares rewriting the dictionary with the original ofstream loop,
+ *        which compares every word against the last one, and with
+ *        Xwriter::write_joined.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. writer_bench.cpp -o writer_bench
+ *        Run:   ./writer_bench [path to word list] [output path]
+ *        Pass /dev/null as the output path to measure CPU cost alone.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <fstream>
+#include <string_view>
+#include "Xvector.hpp"
+#include "XmappedFile.hpp"
+#include "Xwriter.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    const char *path = argc > 1 ? argv[1] : "../dictionary.txt";
+    const char *out = argc > 2 ? argv[2] : "writer_bench.out"; // Removed afterwards only if defaulted
+    XmappedFile file(path);
+    Xvector<string_view> words;
+    split_lines(file.view(), words);
+
+    xbench_report("ofstream << word, compare to last", xbench_min_ns(5, [&]
+    {
+        ofstream outfile(out);
+        for (auto &&i : words)
+        {
+            outfile << i;
+            if (i != *(words.end() - 1))
+                outfile << '\n';
+        }
+    }), words.size());
+
+    xbench_report("Xwriter::write_joined", xbench_min_ns(5, [&]
+    {
+        Xwriter outfile(out);
+        outfile.write_joined(words.begin(), words.end(), "\n");
+        outfile.close();
+    }), words.size());
+
+    if (argc <= 2)
+        remove(out);
+}
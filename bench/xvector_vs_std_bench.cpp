@@ -0,0 +1,165 @@
+/**
+ * @file xvector_vs_std_bench.cpp
+ * @author Angel Badilo Hernandez (https://github.com/It-Is-Legend27)
+ * @brief Benchmark suite comparing Xvector with std::vector on push_back,
+ *        append_range, iteration, random access, resize, erase and copy, for
+ *        int, string and a 256-byte struct. Inputs come from fixed seeds, and each
+ *        measurement keeps the fastest of several runs.
+ *
+ *        Build: g++ -std=c++17 -O2 -I.. xvector_vs_std_bench.cpp -o xvector_vs_std_bench
+ *        Run:   ./xvector_vs_std_bench [--format=table|csv|json] [--out=PATH] [--reps=N]
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "Xvector.hpp"
+#include "Xbench.hpp"
+using namespace std;
+
+struct Blob256
+{
+    uint64_t v[32];
+
+    Blob256() : v{} {}
+    explicit Blob256(uint64_t seed)
+    {
+        for (size_t i = 0; i < 32; i++)
+            v[i] = seed * 31 + i;
+    }
+};
+
+/**
+ * @brief Builds the i-th test element of each type.
+ *
+ */
+template <typename T>
+T make(size_t i);
+
+template <>
+int make<int>(size_t i) { return static_cast<int>(i * 2654435761u); }
+
+template <>
+string make<string>(size_t i) { return string(i % 41, static_cast<char>('a' + i % 26)); } // Mixes short and heap strings
+
+template <>
+Blob256 make<Blob256>(size_t i) { return Blob256(i); }
+
+/**
+ * @brief Reads one value out of an element so the work cannot be dropped.
+ *
+ */
+inline uint64_t touch(int x) { return static_cast<uint64_t>(x); }
+inline uint64_t touch(const string &s) { return s.size(); }
+inline uint64_t touch(const Blob256 &b) { return b.v[0]; }
+
+/**
+ * @brief Appends a range with each container's bulk call.
+ *
+ */
+template <typename T, typename It>
+void append_range(vector<T> &v, It first, It last) { v.insert(v.end(), first, last); }
+
+template <typename T, typename It>
+void append_range(Xvector<T> &v, It first, It last) { v.append_range(first, last); }
+
+template <typename Vec, typename T>
+void run_suite(Xbench &bench, const char *container, const char *type, size_t n)
+{
+    vector<T> source;
+    for (size_t i = 0; i < n; i++)
+        source.push_back(make<T>(i));
+
+    mt19937_64 rng(42);
+    vector<size_t> indices(n);
+    for (size_t &i : indices)
+        i = rng() % n;
+
+    bench.run("push_back", container, type, n, [&]
+    {
+        Vec v;
+        for (const T &x : source)
+            v.push_back(x);
+        do_not_optimize(v.begin());
+    });
+
+    Vec filled;
+    for (const T &x : source)
+        filled.push_back(x);
+
+    bench.run("append_range", container, type, n, [&]
+    {
+        Vec v;
+        const T *src = source.data();
+        for (size_t i = 0; i < 8; i++) // Merge eight partial lists, as after a parallel load
+            append_range(v, src + n * i / 8, src + n * (i + 1) / 8);
+        do_not_optimize(v.begin());
+    });
+
+    bench.run("iterate", container, type, n, [&]
+    {
+        uint64_t sum = 0;
+        for (const T &x : filled)
+            sum += touch(x);
+        do_not_optimize(sum);
+    });
+
+    bench.run("random_access", container, type, n, [&]
+    {
+        uint64_t sum = 0;
+        for (size_t i : indices)
+            sum += touch(filled[i]);
+        do_not_optimize(sum);
+    });
+
+    bench.run("resize", container, type, n, [&]
+    {
+        Vec v;
+        v.resize(n);
+        v.resize(n / 2);
+        v.resize(n);
+        do_not_optimize(v.begin());
+    });
+
+    bench.run("erase_middle", container, type, n, [&]
+    {
+        Vec v;
+        for (const T &x : source)
+            v.push_back(x);
+        for (size_t i = 0; i < 64; i++) // 64 single erases from the middle
+            v.erase(v.begin() + v.size() / 2);
+        v.erase(v.begin() + v.size() / 4, v.begin() + v.size() / 2);
+        do_not_optimize(v.begin());
+    });
+
+    bench.run("copy", container, type, n, [&]
+    {
+        Vec copy(filled);
+        do_not_optimize(copy.begin());
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    Xbench bench(argc, argv);
+    const size_t n = 100000;
+
+    run_suite<Xvector<int>, int>(bench, "Xvector", "int", n);
+    run_suite<vector<int>, int>(bench, "std::vector", "int", n);
+    run_suite<Xvector<string>, string>(bench, "Xvector", "string", n);
+    run_suite<vector<string>, string>(bench, "std::vector", "string", n);
+    run_suite<Xvector<Blob256>, Blob256>(bench, "Xvector", "Blob256", n);
+    run_suite<vector<Blob256>, Blob256>(bench, "std::vector", "Blob256", n);
+
+    if (!bench.write())
+    {
+        fprintf(stderr, "could not open output file\n");
+        return 1;
+    }
+}
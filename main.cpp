@@ -1,28 +1,51 @@
 #include <iostream>
-#include <fstream>
-#include "Xvector.hpp"
-#include <string>
+#include "XmappedFile.hpp"
+#include "Xsnapshot.hpp"
+#include "Xwriter.hpp"
+#include <string_view>
 using namespace std;
 
+#ifdef XVECTOR_TRACK
+using word_list = TrackedXvector<string_view>; // Build with -DXVECTOR_TRACK to see what growth cost
+#else
+using word_list = Xvector<string_view>;
+#endif
+
 int main()
 {
-    ifstream infile;
-    ofstream outfile;
-    infile.open("dictionary.txt");
-    outfile.open("test.txt");
-    string word;
-    Xvector<string> words;
-    while (infile >> word)
-    {
-        words.push_back(word);
-    }
-
-    for (auto &&i : words)
     {
-        outfile << i;
-        if (i != *(words.end() - 1))
-            outfile << '\n';
+        uint64_t tag = xsnapshot_file_tag("dictionary.txt");
+        Xwriter outfile("test.txt");
+        Xsnapshot snapshot;
+        if (snapshot.load("dictionary.xsnap", tag)) // Parsed on an earlier run
+            outfile.write_joined(snapshot.begin(), snapshot.end(), "\n");
+        else
+        {
+            try
+            {
+                XmappedFile infile("dictionary.txt");
+                word_list words;
+                split_lines_parallel(infile.view(), words);
+                try
+                {
+                    xsnapshot_save("dictionary.xsnap", words.begin(), words.end(), tag);
+                }
+                catch (const runtime_error &e) // Only a cache: the next run parses the text again
+                {
+                    cerr << e.what() << '\n';
+                }
+                outfile.write_joined(words.begin(), words.end(), "\n");
+            }
+            catch (const runtime_error &e) // E.g. dictionary.txt is missing
+            {
+                cerr << e.what() << '\n';
+                return 1;
+            }
+        }
+        outfile.close();
     }
 
-    infile.close();
-}
\ No newline at end of file
+#ifdef XVECTOR_TRACK
+    xvector_tracking_report(stderr);
+#endif
+}